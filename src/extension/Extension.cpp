@@ -22,6 +22,7 @@ specific language governing permissions and limitations under the License.
 #include "UI/MainWindow.h"
 
 #include <JSONHelpers.h>
+#include <atomic>
 #include <juce_events/juce_events.h>
 #include <memory>
 #include <reaper_plugin_functions.h>
@@ -90,7 +91,8 @@ namespace AK::ReaWwise
 	{
 		using namespace AK::WwiseAuthoringAPI;
 
-		static std::unique_ptr<WwiseTransfer::WaapiClient> waapiClient;
+		// Shared with the request jobs, which keep the client alive until their call returns
+		static std::shared_ptr<WwiseTransfer::WaapiClient> waapiClient;
 
 		template <typename Type>
 		static bool isObjectValid(Type* object, const std::set<Type>& objectSet)
@@ -260,12 +262,43 @@ namespace AK::ReaWwise
 
 		static std::set<std::shared_ptr<AkJsonRef>> objects;
 
+		struct WaapiCall
+		{
+			std::string uri;
+			AkJson args;
+			AkJson options;
+			bool status{false};
+			AkJson result;
+		};
+
+		// Calls made off the main thread. Only the worker threads touch the calls until pendingCalls reaches zero.
+		struct WaapiRequest
+		{
+			std::vector<WaapiCall> calls;
+			bool isBatch{false};
+			std::atomic<int> pendingCalls{0};
+			std::atomic<bool> cancelled{false};
+
+			bool isDone() const
+			{
+				return pendingCalls.load(std::memory_order_acquire) == 0;
+			}
+		};
+
+		static std::set<std::shared_ptr<WaapiRequest>> requests;
+
+		// Calls of a batch are sent from several threads so that they are pipelined on the WAMP session
+		static constexpr int maxConcurrentWaapiCalls = 8;
+		static constexpr int requestJobRemovalTimeoutMs = 5000;
+		static constexpr int pendingJobRemovalTimeoutMs = 0;
+		static std::unique_ptr<juce::ThreadPool> requestThreadPool;
+
 		///////// WAAPI /////////
 
 		static bool Waapi_Connect(const char* ipAddress, intptr_t port)
 		{
 			if(waapiClient == nullptr)
-				waapiClient.reset(new WwiseTransfer::WaapiClient());
+				waapiClient = std::make_shared<WwiseTransfer::WaapiClient>();
 
 			if(!waapiClient->isConnected())
 				return waapiClient->connect(ipAddress, port);
@@ -282,12 +315,24 @@ namespace AK::ReaWwise
 
 		static void Waapi_Disconnect()
 		{
+			// Pending requests are discarded, their handles become invalid. Calls already running are not waited for.
+			for(const auto& request : requests)
+				request->cancelled = true;
+
+			requests.clear();
+
+			bool noJobRunning = true;
+
+			if(requestThreadPool != nullptr)
+				noJobRunning = requestThreadPool->removeAllJobs(true, pendingJobRemovalTimeoutMs);
+
 			if(waapiClient != nullptr)
 			{
-				if(waapiClient->isConnected())
+				// Otherwise the client disconnects when the last running call releases it
+				if(noJobRunning && waapiClient->isConnected())
 					waapiClient->disconnect();
 
-				waapiClient.reset(nullptr);
+				waapiClient.reset();
 			}
 		}
 
@@ -337,6 +382,190 @@ namespace AK::ReaWwise
 			return Waapi_Call(arguments.get<0>(), arguments.get<1>(), arguments.get<2>());
 		}
 
+		static const char* Waapi_GetMetrics()
+		{
+			returnString = juce::JSON::toString(WwiseTransfer::WaapiMetrics::getInstance().toVar(), true).toStdString();
+
+			return returnString.c_str();
+		}
+
+		static void* Waapi_GetMetricsVarArg(void** argv, int argc)
+		{
+			juce::ignoreUnused(argv, argc);
+
+			return (void*)Waapi_GetMetrics();
+		}
+
+		static void Waapi_ResetMetrics()
+		{
+			WwiseTransfer::WaapiMetrics::getInstance().reset();
+		}
+
+		static void Waapi_ResetMetricsVarArg(void** argv, int argc)
+		{
+			juce::ignoreUnused(argv, argc);
+
+			Waapi_ResetMetrics();
+		}
+
+		static void* submitWaapiRequest(std::shared_ptr<WaapiRequest> request)
+		{
+			if(requestThreadPool == nullptr)
+				requestThreadPool = std::make_unique<juce::ThreadPool>(maxConcurrentWaapiCalls);
+
+			request->pendingCalls = static_cast<int>(request->calls.size());
+
+			for(std::size_t i = 0; i < request->calls.size(); ++i)
+			{
+				requestThreadPool->addJob([request, i, client = waapiClient]()
+					{
+						auto& call = request->calls[i];
+
+						if(!request->cancelled)
+							call.status = client->call(call.uri.c_str(), call.args, call.options, call.result);
+
+						request->pendingCalls.fetch_sub(1, std::memory_order_release);
+					});
+			}
+
+			auto insert = requests.insert(request);
+
+			return (void*)&(*insert.first);
+		}
+
+		static void* Waapi_CallAsync(const char* uri, std::shared_ptr<AkJsonRef>* args, std::shared_ptr<AkJsonRef>* options)
+		{
+			if(isWaapiClientConnected() && uri != nullptr && isObjectValid(args, objects) && isObjectValid(options, objects))
+			{
+				auto request = std::make_shared<WaapiRequest>();
+				request->calls.push_back(WaapiCall{uri, AkJsonRefToAkJson(*args), AkJsonRefToAkJson(*options)});
+
+				return submitWaapiRequest(request);
+			}
+
+			return nullptr;
+		}
+
+		static void* Waapi_CallAsyncVarArg(void** argv, int argc)
+		{
+			juce::ignoreUnused(argc);
+
+			Arguments<const char*, std::shared_ptr<AkJsonRef>*, std::shared_ptr<AkJsonRef>*> arguments(argv);
+
+			return Waapi_CallAsync(arguments.get<0>(), arguments.get<1>(), arguments.get<2>());
+		}
+
+		static void* Waapi_CallBatch(std::shared_ptr<AkJsonRef>* calls)
+		{
+			if(isWaapiClientConnected() && isObjectValid(calls, objects) && (**calls).isArray())
+			{
+				auto request = std::make_shared<WaapiRequest>();
+				request->isBatch = true;
+
+				for(auto& callRef : std::get<AkJsonRef::Array>((**calls).data))
+				{
+					if(!callRef->isMap())
+						return nullptr;
+
+					auto& map = std::get<AkJsonRef::Map>(callRef->data);
+
+					auto uri = map.find("uri");
+					if(uri == map.end() || !uri->second->isVariant() || !std::get<AkVariant>(uri->second->data).IsString())
+						return nullptr;
+
+					auto args = map.find("args");
+					auto options = map.find("options");
+
+					request->calls.push_back(WaapiCall{
+						std::get<AkVariant>(uri->second->data).GetString(),
+						args != map.end() ? AkJsonRefToAkJson(args->second) : AkJson(AkJson::Map{}),
+						options != map.end() ? AkJsonRefToAkJson(options->second) : AkJson(AkJson::Map{}),
+					});
+				}
+
+				return submitWaapiRequest(request);
+			}
+
+			return nullptr;
+		}
+
+		static void* Waapi_CallBatchVarArg(void** argv, int argc)
+		{
+			juce::ignoreUnused(argc);
+
+			Arguments<std::shared_ptr<AkJsonRef>*> arguments(argv);
+
+			return Waapi_CallBatch(arguments.get<0>());
+		}
+
+		static bool Waapi_Poll(std::shared_ptr<WaapiRequest>* request)
+		{
+			return isObjectValid(request, requests) && (**request).isDone();
+		}
+
+		static void* Waapi_PollVarArg(void** argv, int argc)
+		{
+			juce::ignoreUnused(argc);
+
+			Arguments<std::shared_ptr<WaapiRequest>*> arguments(argv);
+
+			return (void*)Waapi_Poll(arguments.get<0>());
+		}
+
+		// Returns the result of a finished request and releases the request handle
+		static void* Waapi_GetResult(std::shared_ptr<WaapiRequest>* request)
+		{
+			if(!Waapi_Poll(request))
+				return nullptr;
+
+			auto finishedRequest = *request;
+			requests.erase(finishedRequest);
+
+			AkJsonRefWithStatus akJsonResult;
+
+			if(finishedRequest->isBatch)
+			{
+				akJsonResult.status = true;
+
+				AkJsonRef::Array results;
+
+				for(const auto& call : finishedRequest->calls)
+				{
+					akJsonResult.status = akJsonResult.status && call.status;
+
+					results.push_back(std::make_shared<AkJsonRef>(AkJsonRef::Map{
+						{"status", std::make_shared<AkJsonRef>(AkVariant(call.status))},
+						{"result", std::make_shared<AkJsonRef>(AkJsonToAkJsonRef(call.result))},
+					}));
+				}
+
+				akJsonResult.data = results;
+			}
+			else
+			{
+				const auto& call = finishedRequest->calls.front();
+
+				akJsonResult.status = call.status;
+				akJsonResult.data = AkJsonToAkJsonRef(call.result).data;
+			}
+
+			auto insert = objects.insert(std::make_shared<AkJsonRefWithStatus>(akJsonResult));
+
+			if(insert.second)
+				return (void*)&(*insert.first);
+
+			return nullptr;
+		}
+
+		static void* Waapi_GetResultVarArg(void** argv, int argc)
+		{
+			juce::ignoreUnused(argc);
+
+			Arguments<std::shared_ptr<WaapiRequest>*> arguments(argv);
+
+			return Waapi_GetResult(arguments.get<0>());
+		}
+
 		///////// AkJson_Any /////////
 
 		template <typename T>
@@ -761,6 +990,12 @@ namespace AK::ReaWwise
 			AK_RWT_GENERATE_API_FUNC_DEF(Waapi_Connect, "bool", "const char*,int", "ipAddress,port", "Ak: Connect to WAAPI (Returns connection status as bool)"),
 			AK_RWT_GENERATE_API_FUNC_DEF(Waapi_Disconnect, "void", "", "", "Ak: Disconnect from WAAPI"),
 			AK_RWT_GENERATE_API_FUNC_DEF(Waapi_Call, "*", "const char*,*,*", "uri,*,*", "Ak: Make a call to WAAPI"),
+			AK_RWT_GENERATE_API_FUNC_DEF(Waapi_CallAsync, "*", "const char*,*,*", "uri,*,*", "Ak: Make a call to WAAPI without waiting for it (Returns a request to pass to Waapi_Poll and Waapi_GetResult)"),
+			AK_RWT_GENERATE_API_FUNC_DEF(Waapi_CallBatch, "*", "*", "*", "Ak: Make several calls to WAAPI at once from an array of maps with uri, args and options (Returns a request whose result is an array of maps with status and result)"),
+			AK_RWT_GENERATE_API_FUNC_DEF(Waapi_Poll, "bool", "*", "*", "Ak: Check whether a request is finished"),
+			AK_RWT_GENERATE_API_FUNC_DEF(Waapi_GetResult, "*", "*", "*", "Ak: Get the result of a finished request (The request can't be used afterwards)"),
+			AK_RWT_GENERATE_API_FUNC_DEF(Waapi_GetMetrics, "const char*", "", "", "Ak: Get per procedure WAAPI call metrics as a JSON array (calls, failures, retries, bytes sent and received, latency percentiles in ms)"),
+			AK_RWT_GENERATE_API_FUNC_DEF(Waapi_ResetMetrics, "void", "", "", "Ak: Reset the WAAPI call metrics"),
 
 			AK_RWT_GENERATE_API_FUNC_DEF(AkJson_Map, "*", "", "", "Ak: Create a map object"),
 			AK_RWT_GENERATE_API_FUNC_DEF(AkJson_Map_Get, "*", "*,const char*", "*,key", "Ak: Get a map object"),
@@ -846,6 +1081,9 @@ namespace AK::ReaWwise
 
 		reaperPlugin->addExtensionsMainMenu();
 
+		// Session changes are still detected by polling if REAPER refuses the control surface
+		reaperContext->registerChangeNotifications();
+
 		for(const auto& apiFunctionDefinition : Scripting::apiFunctionDefinitions)
 		{
 			reaperPlugin->registerFunction(apiFunctionDefinition.Api, (void*)apiFunctionDefinition.FunctionPointer);
@@ -872,8 +1110,18 @@ namespace AK::ReaWwise
 		if(reaperContext != nullptr)
 			reaperContext.reset(nullptr);
 
+		// Running calls hold the client, they must be done before the extension is unloaded
+		if(Scripting::requestThreadPool != nullptr)
+		{
+			for(const auto& request : Scripting::requests)
+				request->cancelled = true;
+
+			Scripting::requestThreadPool->removeAllJobs(true, Scripting::requestJobRemovalTimeoutMs);
+			Scripting::requestThreadPool.reset(nullptr);
+		}
+
 		if(Scripting::waapiClient != nullptr)
-			Scripting::waapiClient.reset(nullptr);
+			Scripting::waapiClient.reset();
 
 		if(Scripting::objects.size() > 0)
 			Scripting::objects.clear();
@@ -15,11 +15,14 @@ specific language governing permissions and limitations under the License.
 
 #include "ReaperContext.h"
 
+#include "RenderStats.h"
 #include "Helpers/StringHelper.h"
 #include "Helpers/WwiseHelper.h"
 #include "Model/Wwise.h"
 
-#include <regex>
+#include <algorithm>
+#include <reaper_plugin.h>
+#include <string_view>
 
 namespace AK::ReaWwise
 {
@@ -31,6 +34,9 @@ namespace AK::ReaWwise
 		const juce::String stateKey = "state";
 		const juce::String applicationKey = "ReaWwise";
 		const juce::String defaultRenderPattern = "untitled";
+		constexpr int minPollIntervalMs = 100;
+		constexpr int maxPollIntervalMs = 1600;
+		constexpr std::size_t maxResolvedRenderPatterns = 16;
 	} // namespace ReaperContextConstants
 
 	enum ReaperCommands
@@ -38,13 +44,121 @@ namespace AK::ReaWwise
 		Render = 42230
 	};
 
+	// Returns the number of bytes used by a null or double null terminated string, including the terminators
+	static std::size_t getUsedBufferSize(const char* buffer, std::size_t bufferSize, bool isMultiString)
+	{
+		if(!isMultiString)
+			return std::min(static_cast<std::size_t>(std::find(buffer, buffer + bufferSize, '\0') - buffer) + 1, bufferSize);
+
+		for(std::size_t i = 1; i < bufferSize; ++i)
+		{
+			if(buffer[i] == '\0' && buffer[i - 1] == '\0')
+				return i + 1;
+		}
+
+		return bufferSize;
+	}
+
+	// Receives REAPER's control surface notifications, which cover track, selection, marker and project tab changes.
+	// Render settings do not send notifications, so those are still picked up by polling.
+	class ReaperContext::ChangeNotifier
+		: public IReaperControlSurface
+	{
+	public:
+		ChangeNotifier(std::atomic<bool>& changeNotified)
+			: changeNotified(changeNotified)
+		{
+		}
+
+		const char* GetTypeString() override
+		{
+			return "";
+		}
+
+		const char* GetDescString() override
+		{
+			return "ReaWwise change notifier";
+		}
+
+		const char* GetConfigString() override
+		{
+			return "";
+		}
+
+		void SetTrackListChange() override
+		{
+			changeNotified = true;
+		}
+
+		void SetSurfaceMute(MediaTrack* track, bool mute) override
+		{
+			juce::ignoreUnused(track, mute);
+
+			changeNotified = true;
+		}
+
+		void SetSurfaceSelected(MediaTrack* track, bool selected) override
+		{
+			juce::ignoreUnused(track, selected);
+
+			changeNotified = true;
+		}
+
+		void SetSurfaceSolo(MediaTrack* track, bool solo) override
+		{
+			juce::ignoreUnused(track, solo);
+
+			changeNotified = true;
+		}
+
+		void SetTrackTitle(MediaTrack* track, const char* title) override
+		{
+			juce::ignoreUnused(track, title);
+
+			changeNotified = true;
+		}
+
+		void OnTrackSelection(MediaTrack* track) override
+		{
+			juce::ignoreUnused(track);
+
+			changeNotified = true;
+		}
+
+		int Extended(int call, void* parm1, void* parm2, void* parm3) override
+		{
+			juce::ignoreUnused(parm1, parm2, parm3);
+
+			// Most extended calls (FX parameters, send levels, ...) can fire continuously during playback and do not affect render items
+			if(call == CSURF_EXT_RESET || call == CSURF_EXT_SETPROJECTMARKERCHANGE)
+				changeNotified = true;
+
+			return 0;
+		}
+
+	private:
+		std::atomic<bool>& changeNotified;
+	};
+
 	ReaperContext::ReaperContext(IReaperPlugin& reaperPlugin)
 		: reaperPlugin(reaperPlugin)
+		, changeNotifier(std::make_unique<ChangeNotifier>(changeNotified))
+		, pollIntervalMs(ReaperContextConstants::minPollIntervalMs)
 	{
 	}
 
 	ReaperContext::~ReaperContext()
 	{
+		if(changeNotifierRegistered)
+			reaperPlugin.registerFunction("-csurf_inst", changeNotifier.get());
+	}
+
+	bool ReaperContext::registerChangeNotifications()
+	{
+		if(!changeNotifierRegistered)
+			changeNotifierRegistered = reaperPlugin.registerFunction("csurf_inst", changeNotifier.get()) != 0;
+
+		return changeNotifierRegistered;
 	}
 
 	juce::String ReaperContext::getSessionName()
@@ -108,7 +222,7 @@ namespace AK::ReaWwise
 
 		std::vector<juce::String> renderTargets;
 
-		auto result = getProjectStringBuffer(projectInfo.projectReference, "RENDER_TARGETS_EX");
+		auto result = getProjectStringBuffer(projectInfo.projectReference, "RENDER_TARGETS_EX", true);
 
 		if(result.status)
 			renderTargets = WwiseTransfer::StringHelper::splitDoubleNullTerminatedString(result.buffer);
@@ -137,14 +251,14 @@ namespace AK::ReaWwise
 		return {};
 	}
 
-	ReaperContext::ProjectStringBufferResult ReaperContext::getProjectStringBuffer(ReaProject* proj, const char* key) const
+	ReaperContext::ProjectStringBufferResult ReaperContext::getProjectStringBuffer(ReaProject* proj, const char* key, bool isMultiString) const
 	{
 		ProjectStringBufferResult result;
 
 		if(reaperPlugin.supportsReallocCommands())
 		{
 			// For REAPER 6.68+
-			char buffer[ReaperContextConstants::defaultBufferSize];
+			char buffer[ReaperContextConstants::defaultBufferSize]{};
 			char* bufferPtr = buffer;
 
 			int bufferSize = (int)sizeof(buffer);
@@ -153,20 +267,25 @@ namespace AK::ReaWwise
 
 			result.status = reaperPlugin.getSetProjectInfo_String(proj, key, bufferPtr, false);
 
+			// The reallocated buffer is not zero filled, so only multi-string values can be scanned for their double null terminator
 			if(result.status)
-				result.buffer.assign(bufferPtr, bufferPtr + bufferSize);
+				result.buffer.assign(bufferPtr, bufferPtr + getUsedBufferSize(bufferPtr, static_cast<std::size_t>(bufferSize), isMultiString));
 
 			reaperPlugin.reallocCmdClear(token);
 		}
 		else
 		{
+			// The buffer is kept zeroed between calls, so only the bytes written by REAPER need to be cleared afterwards
 			static std::vector<char> buffer(ReaperContextConstants::largeBufferSize);
-			std::fill(buffer.begin(), buffer.end(), '\0');
 
 			result.status = reaperPlugin.getSetProjectInfo_String(proj, key, &buffer[0], false);
 
+			const auto usedBufferSize = getUsedBufferSize(&buffer[0], buffer.size(), isMultiString);
+
 			if(result.status)
-				result.buffer = buffer;
+				result.buffer.assign(buffer.begin(), buffer.begin() + usedBufferSize);
+
+			std::fill(buffer.begin(), buffer.begin() + usedBufferSize, '\0');
 		}
 
 		return result;
@@ -184,45 +303,35 @@ namespace AK::ReaWwise
 
 		auto projectInfo = getProjectInfo();
 
-		juce::String renderStats = getProjectString(projectInfo.projectReference, "RENDER_STATS");
+		const auto renderStatsBuffer = getProjectStringBuffer(projectInfo.projectReference, "RENDER_STATS").buffer;
+		const auto renderStatsEnd = std::find(renderStatsBuffer.begin(), renderStatsBuffer.end(), '\0');
+		const std::string_view renderStatsText(renderStatsBuffer.data(), static_cast<std::size_t>(std::distance(renderStatsBuffer.begin(), renderStatsEnd)));
+
+		const auto renderStats = RenderStatsParser::parse(renderStatsText);
+
+		// Render stats are matched to render targets by position, which can't be trusted when there are more of them
+		if(renderStats.entries.size() > importItemsForPreview.size())
+		{
+			juce::Logger::writeToLog("Reaper: Mismatch between render stats and render targets");
+			return importItems;
+		}
+
+		if(renderStats.entries.size() < importItemsForPreview.size())
+			juce::Logger::writeToLog("Reaper: Render stats are missing some render targets");
 
-		static juce::String fileToken("FILE:");
-		static juce::String delimiter(';' + fileToken);
+		importItems.reserve(renderStats.entries.size());
 
-		if(renderStats.isNotEmpty())
+		for(std::size_t i = 0; i < renderStats.entries.size(); ++i)
 		{
-			// To ease parsing, append ";FILE:" to the end of renderStats
-			if(renderStats.endsWithChar(';'))
-				renderStats << fileToken;
-			else
-				renderStats << delimiter;
-
-			int endPosition, startPosition = renderStats.indexOf(fileToken) + fileToken.length();
-
-			if(startPosition != -1) // If we don't find the first "FILE:", exit since we are receiving something unexpected
-			{
-				static std::regex regex("(.+?);[A-Z]+");
-
-				while((endPosition = renderStats.indexOf(startPosition, delimiter)) != -1)
-				{
-					auto finalRenderPath = renderStats.substring(startPosition, endPosition).toStdString();
-
-					std::smatch results;
-					if(std::regex_search(finalRenderPath, results, regex))
-						finalRenderPath = results[1];
-
-					const auto& importItemForPreview = importItemsForPreview[importItems.size()];
-
-					importItems.push_back({
-						importItemForPreview.path,
-						importItemForPreview.originalsSubFolder,
-						importItemForPreview.audioFilePath,
-						finalRenderPath,
-					});
-
-					startPosition = endPosition + delimiter.length();
-				}
-			}
+			const auto& importItemForPreview = importItemsForPreview[i];
+			const auto& filePath = renderStats.entries[i].filePath;
+
+			importItems.push_back({
+				importItemForPreview.path,
+				importItemForPreview.originalsSubFolder,
+				importItemForPreview.audioFilePath,
+				juce::String::fromUTF8(filePath.data(), static_cast<int>(filePath.size())),
+			});
 		}
 
 		return importItems;
@@ -238,13 +347,13 @@ namespace AK::ReaWwise
 		// requires alot of logic on our end.
 
 		const auto dummyRenderPattern = juce::File::getSeparatorString();
-		const auto resolvedDummyRenderPattern = getItemListFromRenderPattern(projectInfo.projectReference, dummyRenderPattern, true);
+		const auto& resolvedDummyRenderPattern = getItemListFromRenderPattern(projectInfo.projectReference, dummyRenderPattern, true);
 
 		const auto renderPattern = getRenderPattern(projectInfo);
-		const auto resolvedRenderPattern = getItemListFromRenderPattern(projectInfo.projectReference, renderPattern, true);
+		const auto& resolvedRenderPattern = getItemListFromRenderPattern(projectInfo.projectReference, renderPattern, true);
 
 		const auto originalsSubfolderRenderPattern = originalsSubfolder + juce::File::getSeparatorString();
-		const auto resolvedOriginalsSubfolder = getItemListFromRenderPattern(projectInfo.projectReference, originalsSubfolderRenderPattern, true);
+		const auto& resolvedOriginalsSubfolder = getItemListFromRenderPattern(projectInfo.projectReference, originalsSubfolderRenderPattern, true);
 
 		if(resolvedDummyRenderPattern.size() != resolvedRenderPattern.size() && resolvedDummyRenderPattern.size() != resolvedOriginalsSubfolder.size())
 		{
@@ -275,11 +384,13 @@ namespace AK::ReaWwise
 
 		auto projectInfo = getProjectInfo();
 
+		updateRenderPatternCache(projectInfo.projectReference);
+
 		auto renderTargets = getRenderTargets();
 		auto resolvedOriginalsSubfolder = getOriginalSubfolders(projectInfo, options.originalsSubfolder);
 
 		const auto objectPathsPattern = options.importDestination + options.hierarchyMappingPath;
-		std::vector<juce::String> resolvedObjectPaths = getItemListFromRenderPattern(projectInfo.projectReference, objectPathsPattern, false);
+		const auto& resolvedObjectPaths = getItemListFromRenderPattern(projectInfo.projectReference, objectPathsPattern, false);
 
 		if(renderTargets.size() != resolvedOriginalsSubfolder.size() || renderTargets.size() != resolvedObjectPaths.size())
 		{
@@ -336,6 +447,21 @@ namespace AK::ReaWwise
 
 	bool ReaperContext::sessionChanged()
 	{
+		using namespace ReaperContextConstants;
+
+		const auto now = juce::Time::getMillisecondCounter();
+
+		// Without a notification, the session is polled less and less often for as long as nothing changes
+		if(!changeNotified.exchange(false) && static_cast<int>(now - nextPollTime) < 0)
+			return false;
+
+		juce::ScopedTryLock lock{apiAccess};
+		if(!lock.isLocked())
+		{
+			changeNotified = true;
+			return false;
+		}
+
 		auto sessionChanged = false;
 
 		auto projectInfo = getProjectInfo();
@@ -362,27 +488,71 @@ namespace AK::ReaWwise
 			renderFile,
 			renderPattern};
 
+		if(sessionChanged)
+			resolvedRenderPatterns.clear();
+
+		pollIntervalMs = sessionChanged ? minPollIntervalMs : juce::jmin(pollIntervalMs * 2, maxPollIntervalMs);
+		nextPollTime = now + static_cast<juce::uint32>(pollIntervalMs);
+
 		return sessionChanged;
 	}
 
-	std::vector<juce::String> ReaperContext::getItemListFromRenderPattern(ReaProject* project, const juce::String& pattern, bool suppressIllegalPaths)
+	bool ReaperContext::RenderPatternCacheKey::operator==(const RenderPatternCacheKey& other) const
 	{
-		const int bufferLength = reaperPlugin.resolveRenderPattern(project, suppressIllegalPaths ? "" : nullptr, pattern.toUTF8(), nullptr, 0);
+		return projectReference == other.projectReference &&
+			projectStateCount == other.projectStateCount &&
+			renderSource == other.renderSource &&
+			renderBounds == other.renderBounds;
+	}
+
+	void ReaperContext::updateRenderPatternCache(ReaProject* project)
+	{
+		const RenderPatternCacheKey cacheKey{
+			project,
+			reaperPlugin.getProjectStateChangeCount(project),
+			reaperPlugin.getSetProjectInfo(project, "RENDER_SETTINGS", 0, false),
+			reaperPlugin.getSetProjectInfo(project, "RENDER_BOUNDSFLAG", 0, false)};
+
+		// Patterns that are no longer used, such as the ones typed while editing the hierarchy mapping, are not kept around forever
+		if(cacheKey == renderPatternCacheKey && resolvedRenderPatterns.size() <= ReaperContextConstants::maxResolvedRenderPatterns)
+			return;
+
+		resolvedRenderPatterns.clear();
+		renderPatternCacheKey = cacheKey;
+	}
+
+	const std::vector<juce::String>& ReaperContext::getItemListFromRenderPattern(ReaProject* project, const juce::String& pattern, bool suppressIllegalPaths)
+	{
+		// Resolutions are cached until the project changes, see updateRenderPatternCache
+		auto [it, inserted] = resolvedRenderPatterns.try_emplace({pattern, suppressIllegalPaths});
+		auto& items = it->second;
+
+		if(!inserted)
+			return items;
+
+		const auto path = suppressIllegalPaths ? "" : nullptr;
+
+		const int bufferLength = reaperPlugin.resolveRenderPattern(project, path, pattern.toUTF8(), nullptr, 0);
 
 		if(bufferLength == 0)
-			return {};
+			return items;
 
 		std::vector<char> buffer(bufferLength, '\0');
-		const int newBufferLength = reaperPlugin.resolveRenderPattern(project, suppressIllegalPaths ? "" : nullptr, pattern.toUTF8(), &buffer[0], bufferLength);
+		const int newBufferLength = reaperPlugin.resolveRenderPattern(project, path, pattern.toUTF8(), &buffer[0], bufferLength);
 		if(newBufferLength > bufferLength)
 		{
 			// It is possible the resolved render pattern changes between the two calls to resolveRenderPattern.
 			// For example, a track that is set to render can be unmuted between the two calls which will result in a bigger buffer needed.
 			// In that case we just return nothing and the next call will be good.
 			juce::Logger::writeToLog("Reaper: Mismatch between calls to resolveRenderPattern");
-			return {};
+			resolvedRenderPatterns.erase(it);
+
+			static const std::vector<juce::String> noItems;
+			return noItems;
 		}
 
-		return WwiseTransfer::StringHelper::splitDoubleNullTerminatedString(buffer);
+		items = WwiseTransfer::StringHelper::splitDoubleNullTerminatedString(buffer);
+
+		return items;
 	}
 } // namespace AK::ReaWwise
@@ -19,6 +19,9 @@ specific language governing permissions and limitations under the License.
 #include "IReaperPlugin.h"
 #include "Model/Import.h"
 
+#include <atomic>
+#include <map>
+
 namespace AK::ReaWwise
 {
 	class ReaperContext
@@ -28,6 +31,7 @@ namespace AK::ReaWwise
 		ReaperContext(IReaperPlugin& pluginInfo);
 		~ReaperContext() override;
 
+		bool registerChangeNotifications();
 		bool sessionChanged() override;
 		juce::String getSessionName() override;
 		bool saveState(juce::ValueTree applicationState) override;
@@ -37,6 +41,8 @@ namespace AK::ReaWwise
 		std::vector<WwiseTransfer::Import::Item> getItemsForImport(const WwiseTransfer::Import::Options& options) override;
 
 	private:
+		class ChangeNotifier;
+
 		struct ProjectInfo
 		{
 			ReaProject* projectReference{};
@@ -59,16 +65,36 @@ namespace AK::ReaWwise
 			std::vector<char> buffer;
 		};
 
-		std::vector<juce::String> getItemListFromRenderPattern(ReaProject* project, const juce::String& pattern, bool suppressIllegalPaths = true);
+		struct RenderPatternCacheKey
+		{
+			ReaProject* projectReference{};
+			int projectStateCount{0};
+			double renderSource{0.0};
+			double renderBounds{0.0};
+
+			bool operator==(const RenderPatternCacheKey& other) const;
+		};
+
+		void updateRenderPatternCache(ReaProject* project);
+		const std::vector<juce::String>& getItemListFromRenderPattern(ReaProject* project, const juce::String& pattern, bool suppressIllegalPaths = true);
 		ProjectInfo getProjectInfo() const;
 		juce::String getRenderPattern(const ProjectInfo& projectInfo) const;
 		std::vector<juce::String> getOriginalSubfolders(const ProjectInfo& projectInfo, const juce::String& originalsSubfolder);
 		std::vector<juce::String> getRenderTargets();
 		juce::String getProjectString(ReaProject* proj, const char* key) const;
-		ProjectStringBufferResult getProjectStringBuffer(ReaProject* proj, const char* key) const;
+		ProjectStringBufferResult getProjectStringBuffer(ReaProject* proj, const char* key, bool isMultiString = false) const;
 
 		juce::CriticalSection apiAccess;
 		IReaperPlugin& reaperPlugin;
 		StateInfo stateInfo;
+
+		RenderPatternCacheKey renderPatternCacheKey;
+		std::map<std::pair<juce::String, bool>, std::vector<juce::String>> resolvedRenderPatterns;
+
+		std::unique_ptr<ChangeNotifier> changeNotifier;
+		bool changeNotifierRegistered{false};
+		std::atomic<bool> changeNotified{true};
+		juce::uint32 nextPollTime{0};
+		int pollIntervalMs;
 	};
 } // namespace AK::ReaWwise
@@ -0,0 +1,130 @@
+/*----------------------------------------------------------------------------------------
+
+Copyright (c) 2025 AUDIOKINETIC Inc.
+
+This file is licensed to use under the license available at:
+https://github.com/audiokinetic/ReaWwise/blob/main/License.txt (the "License").
+You may not use this file except in compliance with the License.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations under the License.
+
+----------------------------------------------------------------------------------------*/
+
+
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+namespace AK::ReaWwise
+{
+	struct RenderStatsField
+	{
+		std::string_view key;
+		std::string_view value;
+	};
+
+	struct RenderStatsEntry
+	{
+		std::string_view filePath;
+		std::size_t firstField{0};
+		std::size_t numFields{0};
+	};
+
+	// Views into the RENDER_STATS string, which must outlive them
+	struct RenderStats
+	{
+		std::vector<RenderStatsEntry> entries;
+		std::vector<RenderStatsField> fields;
+
+		std::string_view getField(const RenderStatsEntry& entry, std::string_view key) const
+		{
+			for(auto i = entry.firstField; i < entry.firstField + entry.numFields; ++i)
+			{
+				if(fields[i].key == key)
+					return fields[i].value;
+			}
+
+			return {};
+		}
+	};
+
+	namespace RenderStatsParser
+	{
+		// Returns the length of the key starting at the given position, colon included, or 0 if there is no key there.
+		// Keys are an upper case letter followed by at least one upper case letter or digit, then a colon.
+		inline std::size_t getKeyLength(std::string_view renderStats, std::size_t position)
+		{
+			auto isUpper = [](char character)
+			{
+				return character >= 'A' && character <= 'Z';
+			};
+
+			auto isDigit = [](char character)
+			{
+				return character >= '0' && character <= '9';
+			};
+
+			if(position >= renderStats.size() || !isUpper(renderStats[position]))
+				return 0;
+
+			auto end = position + 1;
+			while(end < renderStats.size() && (isUpper(renderStats[end]) || isDigit(renderStats[end])))
+				++end;
+
+			if(end - position < 2 || end == renderStats.size() || renderStats[end] != ':')
+				return 0;
+
+			return end - position + 1;
+		}
+
+		// RENDER_STATS looks like "FILE:<path>;PEAK:<value>;LUFSI:<value>;FILE:<path>;...". File paths may contain semicolons,
+		// so a field only starts after a semicolon followed by a key. Anything before the first file is ignored.
+		inline RenderStats parse(std::string_view renderStats)
+		{
+			static constexpr std::string_view fileKey = "FILE";
+			constexpr auto npos = std::string_view::npos;
+
+			RenderStats result;
+
+			auto segmentStart = renderStats.find("FILE:");
+
+			while(segmentStart != npos && segmentStart < renderStats.size())
+			{
+				const auto keyLength = getKeyLength(renderStats, segmentStart);
+				const auto valueStart = segmentStart + keyLength;
+
+				auto separator = renderStats.find(';', valueStart);
+				while(separator != npos && getKeyLength(renderStats, separator + 1) == 0)
+					separator = renderStats.find(';', separator + 1);
+
+				auto valueEnd = separator;
+				if(separator == npos)
+				{
+					// The last value may be followed by a semicolon
+					valueEnd = renderStats.size();
+					if(valueEnd > valueStart && renderStats[valueEnd - 1] == ';')
+						--valueEnd;
+				}
+
+				const auto key = renderStats.substr(segmentStart, keyLength - 1);
+				const auto value = renderStats.substr(valueStart, valueEnd - valueStart);
+
+				if(key == fileKey)
+					result.entries.push_back({value, result.fields.size(), 0});
+				else
+				{
+					result.fields.push_back({key, value});
+					++result.entries.back().numFields;
+				}
+
+				segmentStart = separator == npos ? npos : separator + 1;
+			}
+
+			return result;
+		}
+	} // namespace RenderStatsParser
+} // namespace AK::ReaWwise
@@ -0,0 +1,228 @@
+/*----------------------------------------------------------------------------------------
+
+Copyright (c) 2025 AUDIOKINETIC Inc.
+
+This file is licensed to use under the license available at:
+https://github.com/audiokinetic/ReaWwise/blob/main/License.txt (the "License").
+You may not use this file except in compliance with the License.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations under the License.
+
+----------------------------------------------------------------------------------------*/
+
+#include "AudioFileEncoder.h"
+
+#include "Helpers/Base64Helper.h"
+
+#include <chrono>
+
+namespace AK::WwiseTransfer
+{
+	namespace AudioFileEncoderConstants
+	{
+		// Must be a multiple of 3 so that chunks can be encoded independently without padding
+		constexpr int chunkSize = 3 * 64 * 1024;
+		constexpr int jobRemovalTimeoutMs = 5000;
+
+		// Cancellation does not notify the encoder, jobs waiting for memory check it at this interval
+		constexpr int cancellationCheckIntervalMs = 10;
+	} // namespace AudioFileEncoderConstants
+
+	class AudioFileEncoder::EncodeJob
+		: public juce::ThreadPoolJob
+	{
+	public:
+		EncodeJob(AudioFileEncoder& encoder, Waapi::ImportItemRequest& importItemRequest, const std::shared_ptr<EncodingBatch>& encodingBatch)
+			: juce::ThreadPoolJob("EncodeJob")
+			, encoder(encoder)
+			, importItemRequest(importItemRequest)
+			, encodingBatch(encodingBatch)
+		{
+		}
+
+		juce::ThreadPoolJob::JobStatus runJob() override
+		{
+			encoder.onJobFinished(encodingBatch, encode() ? juce::String() : importItemRequest.renderFilePath);
+
+			return juce::ThreadPoolJob::JobStatus::jobHasFinished;
+		}
+
+	private:
+		bool encode()
+		{
+			using namespace AudioFileEncoderConstants;
+
+			if(encoder.isCancelled())
+				return false;
+
+			juce::FileInputStream inputStream(importItemRequest.renderFilePath);
+
+			if(inputStream.failedToOpen())
+				return false;
+
+			const auto fileSize = static_cast<std::size_t>(inputStream.getTotalLength());
+			const auto encodedSize = Base64Helper::getEncodedSize(fileSize);
+
+			if(!encoder.acquireMemory(encodedSize))
+				return false;
+
+			auto& payload = importItemRequest.renderFileWavBase64;
+			payload.resize(encodedSize);
+
+			juce::HeapBlock<char> chunk(chunkSize);
+			std::size_t bytesRead = 0;
+			std::size_t bytesWritten = 0;
+
+			while(bytesRead < fileSize && !shouldExit() && !encoder.isCancelled())
+			{
+				// Only the last chunk may be smaller than chunkSize, otherwise padding would end up in the middle of the payload
+				const auto bytesToRead = static_cast<int>(std::min<std::size_t>(chunkSize, fileSize - bytesRead));
+
+				int chunkBytesRead = 0;
+				while(chunkBytesRead < bytesToRead)
+				{
+					const auto result = inputStream.read(chunk.getData() + chunkBytesRead, bytesToRead - chunkBytesRead);
+
+					if(result <= 0)
+						break;
+
+					chunkBytesRead += result;
+				}
+
+				if(chunkBytesRead != bytesToRead)
+					break;
+
+				Base64Helper::encode(chunk.getData(), static_cast<std::size_t>(chunkBytesRead), payload.data() + bytesWritten);
+
+				bytesRead += chunkBytesRead;
+				bytesWritten += Base64Helper::getEncodedSize(chunkBytesRead);
+			}
+
+			if(bytesRead != fileSize || bytesWritten != encodedSize)
+			{
+				std::string().swap(payload);
+				encoder.releaseMemory(encodedSize);
+
+				return false;
+			}
+
+			return true;
+		}
+
+		AudioFileEncoder& encoder;
+		Waapi::ImportItemRequest& importItemRequest;
+		std::shared_ptr<EncodingBatch> encodingBatch;
+	};
+
+	AudioFileEncoder::AudioFileEncoder(std::size_t memoryBudget, int numberOfThreads, std::shared_ptr<WaapiHelper::CancellationToken> cancellationToken)
+		: memoryBudget(memoryBudget)
+		, cancellationToken(std::move(cancellationToken))
+		, threadPool(numberOfThreads)
+	{
+	}
+
+	AudioFileEncoder::~AudioFileEncoder()
+	{
+		{
+			std::lock_guard lock(mutex);
+			exiting = true;
+		}
+
+		condition.notify_all();
+
+		threadPool.removeAllJobs(true, AudioFileEncoderConstants::jobRemovalTimeoutMs);
+	}
+
+	std::shared_ptr<AudioFileEncoder::EncodingBatch> AudioFileEncoder::encodeAsync(std::vector<Waapi::ImportItemRequest>& importItemRequests)
+	{
+		auto encodingBatch = std::make_shared<EncodingBatch>();
+
+		{
+			std::lock_guard lock(mutex);
+			encodingBatch->pendingJobs = static_cast<int>(importItemRequests.size());
+		}
+
+		for(auto& importItemRequest : importItemRequests)
+			threadPool.addJob(new EncodeJob(*this, importItemRequest, encodingBatch), true);
+
+		return encodingBatch;
+	}
+
+	std::vector<juce::String> AudioFileEncoder::waitForCompletion(const std::shared_ptr<EncodingBatch>& encodingBatch)
+	{
+		std::unique_lock lock(mutex);
+
+		condition.wait(lock, [&encodingBatch]
+			{
+				return encodingBatch->pendingJobs == 0;
+			});
+
+		return encodingBatch->failedFiles;
+	}
+
+	void AudioFileEncoder::release(std::vector<Waapi::ImportItemRequest>& importItemRequests)
+	{
+		std::size_t releasedSize = 0;
+
+		for(auto& importItemRequest : importItemRequests)
+		{
+			releasedSize += importItemRequest.renderFileWavBase64.size();
+			std::string().swap(importItemRequest.renderFileWavBase64);
+		}
+
+		releaseMemory(releasedSize);
+	}
+
+	bool AudioFileEncoder::acquireMemory(std::size_t size)
+	{
+		std::unique_lock lock(mutex);
+
+		// A payload bigger than the whole budget is allowed through once nothing else is in memory
+		auto canAcquire = [this, size]
+		{
+			return exiting || isCancelled() || memoryInUse == 0 || memoryInUse + size <= memoryBudget;
+		};
+
+		while(!condition.wait_for(lock, std::chrono::milliseconds(AudioFileEncoderConstants::cancellationCheckIntervalMs), canAcquire))
+			continue;
+
+		if(exiting || isCancelled())
+			return false;
+
+		memoryInUse += size;
+
+		return true;
+	}
+
+	void AudioFileEncoder::releaseMemory(std::size_t size)
+	{
+		{
+			std::lock_guard lock(mutex);
+			memoryInUse -= std::min(size, memoryInUse);
+		}
+
+		condition.notify_all();
+	}
+
+	bool AudioFileEncoder::isCancelled() const
+	{
+		return cancellationToken != nullptr && cancellationToken->isCancelled();
+	}
+
+	void AudioFileEncoder::onJobFinished(const std::shared_ptr<EncodingBatch>& encodingBatch, const juce::String& failedFile)
+	{
+		{
+			std::lock_guard lock(mutex);
+
+			if(failedFile.isNotEmpty())
+				encodingBatch->failedFiles.emplace_back(failedFile);
+
+			--encodingBatch->pendingJobs;
+		}
+
+		condition.notify_all();
+	}
+} // namespace AK::WwiseTransfer
@@ -0,0 +1,71 @@
+/*----------------------------------------------------------------------------------------
+
+Copyright (c) 2025 AUDIOKINETIC Inc.
+
+This file is licensed to use under the license available at:
+https://github.com/audiokinetic/ReaWwise/blob/main/License.txt (the "License").
+You may not use this file except in compliance with the License.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations under the License.
+
+----------------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "Helpers/WaapiHelper.h"
+#include "Model/Waapi.h"
+
+#include <condition_variable>
+#include <juce_core/juce_core.h>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace AK::WwiseTransfer
+{
+	// Encodes render files to base64 on worker threads for cross machine transfers.
+	// Files are streamed from disk in chunks and the payloads alive at any given time never exceed the memory budget,
+	// unless a single file is bigger than the budget, in which case it is encoded on its own.
+	class AudioFileEncoder
+	{
+	public:
+		struct EncodingBatch
+		{
+			int pendingJobs{0};
+			std::vector<juce::String> failedFiles;
+		};
+
+		// Once cancelled, files not encoded yet fail right away so that waiting for a batch returns quickly
+		AudioFileEncoder(std::size_t memoryBudget, int numberOfThreads, std::shared_ptr<WaapiHelper::CancellationToken> cancellationToken = nullptr);
+		~AudioFileEncoder();
+
+		// Starts encoding the render files of the requests. The requests must not move until waitForCompletion returns.
+		std::shared_ptr<EncodingBatch> encodeAsync(std::vector<Waapi::ImportItemRequest>& importItemRequests);
+
+		// Blocks until every file of the batch is encoded. Returns the files that could not be encoded.
+		std::vector<juce::String> waitForCompletion(const std::shared_ptr<EncodingBatch>& encodingBatch);
+
+		// Frees the payloads of the requests and gives their memory back to the budget
+		void release(std::vector<Waapi::ImportItemRequest>& importItemRequests);
+
+	private:
+		class EncodeJob;
+
+		bool acquireMemory(std::size_t size);
+		void releaseMemory(std::size_t size);
+		void onJobFinished(const std::shared_ptr<EncodingBatch>& encodingBatch, const juce::String& failedFile);
+		bool isCancelled() const;
+
+		std::mutex mutex;
+		std::condition_variable condition;
+		const std::size_t memoryBudget;
+		std::size_t memoryInUse{0};
+		bool exiting{false};
+		std::shared_ptr<WaapiHelper::CancellationToken> cancellationToken;
+
+		juce::ThreadPool threadPool;
+	};
+} // namespace AK::WwiseTransfer
@@ -15,24 +15,312 @@ specific language governing permissions and limitations under the License.
 
 #include "DawWatcher.h"
 
+#include "Core/DirectoryListingCache.h"
+#include "Core/PreviewTree.h"
 #include "Helpers/ImportHelper.h"
+#include "Helpers/WwisePath.h"
 #include "Model/IDs.h"
 #include "Model/Import.h"
 #include "Model/Waapi.h"
 
 #include <juce_gui_basics/juce_gui_basics.h>
-#include <optional>
-#include <unordered_map>
+#include <set>
 
 namespace AK::WwiseTransfer
 {
-	struct PreviewOptions
+	namespace DawWatcherConstants
 	{
-		Import::ContainerNameExistsOption containerNameExists;
-		juce::String projectPath;
-		juce::String originalsFolder;
-		bool waqlEnabled;
-		juce::String languageSubfolder;
+		constexpr int previewJobRemovalTimeoutMs = 5000;
+		constexpr std::size_t maxChangedItemsRatio = 2;
+	} // namespace DawWatcherConstants
+
+	// Builds the preview on the preview thread, then applies it on the message thread
+	class DawWatcher::PreviewJob
+		: public juce::ThreadPoolJob
+	{
+	public:
+		PreviewJob(DawWatcher& dawWatcher, PreviewOptions options, std::vector<Import::PreviewItem> importItems, bool forceRebuild, std::shared_ptr<WaapiHelper::CancellationToken> cancellationToken)
+			: juce::ThreadPoolJob("PreviewJob")
+			, dawWatcher(dawWatcher)
+			, options(std::move(options))
+			, importItems(std::move(importItems))
+			, forceRebuild(forceRebuild)
+			, cancellationToken(std::move(cancellationToken))
+		{
+		}
+
+		juce::ThreadPoolJob::JobStatus runJob() override
+		{
+			if(isCancelled())
+				return juce::ThreadPoolJob::JobStatus::jobHasFinished;
+
+			auto previewItemFingerprints = ImportHelper::getPreviewItemFingerprints(importItems);
+
+			Import::PreviewItemChanges changes;
+
+			if(!forceRebuild)
+				changes = ImportHelper::getPreviewItemChanges(dawWatcher.lastPreviewItemFingerprints, previewItemFingerprints);
+
+			dawWatcher.lastPreviewItemFingerprints = std::move(previewItemFingerprints);
+
+			// Past a point, patching the rows of the changed items costs more than building the preview again
+			if(forceRebuild || changes.size() * DawWatcherConstants::maxChangedItemsRatio > importItems.size())
+				rebuildPreview();
+			else if(!changes.isEmpty())
+				updatePreview(changes);
+			else
+				postToMessageThread(&PreviewJob::onPreviewApplied);
+
+			return juce::ThreadPoolJob::JobStatus::jobHasFinished;
+		}
+
+	private:
+		DawWatcher& dawWatcher;
+		PreviewOptions options;
+		std::vector<Import::PreviewItem> importItems;
+		bool forceRebuild;
+		std::shared_ptr<WaapiHelper::CancellationToken> cancellationToken;
+
+		bool isCancelled()
+		{
+			return shouldExit() || cancellationToken->isCancelled();
+		}
+
+		// The token is cancelled on the message thread when a newer preview is requested or when the watcher is destroyed,
+		// so function never runs for a stale preview or a destroyed watcher
+		template <typename Function>
+		void postToMessageThread(Function function)
+		{
+			auto onMessageThread = [&dawWatcher = dawWatcher, cancellationToken = cancellationToken, function = std::move(function)]()
+			{
+				if(!cancellationToken->isCancelled())
+					function(dawWatcher);
+			};
+
+			juce::MessageManager::callAsync(onMessageThread);
+		}
+
+		static void onPreviewApplied(DawWatcher& dawWatcher)
+		{
+			dawWatcher.previewInProgress = false;
+			dawWatcher.previewLoading = false;
+		}
+
+		// Builds the whole preview and replaces the current one with it
+		void rebuildPreview()
+		{
+			PreviewTree previewTree;
+
+			if(!buildPreviewTree(importItems, previewTree))
+				return;
+
+			postToMessageThread([preview = previewTree.toValueTree(IDs::previewItems)](DawWatcher& dawWatcher)
+				{
+					ImportHelper::applyValueTreeDiff(dawWatcher.previewItems, preview);
+					onPreviewApplied(dawWatcher);
+				});
+		}
+
+		// Only builds the rows of the changed items, then removes their previous rows from the current preview and merges the new ones into it
+		void updatePreview(const Import::PreviewItemChanges& changes)
+		{
+			auto addedItems = changes.added;
+			std::vector<ImportHelper::PreviewItemRow> removedRows;
+
+			for(const auto& removedItem : changes.removed)
+				removedRows.push_back(getPreviewItemRow(removedItem));
+
+			for(const auto& modifiedItem : changes.modified)
+			{
+				removedRows.push_back(getPreviewItemRow(modifiedItem.previous));
+				addedItems.push_back(modifiedItem.current);
+			}
+
+			PreviewTree previewTree;
+
+			if(!buildPreviewTree(addedItems, previewTree))
+				return;
+
+			postToMessageThread([removedRows = std::move(removedRows), addedRows = previewTree.toValueTree(IDs::previewItems)](DawWatcher& dawWatcher)
+				{
+					ImportHelper::removePreviewItemRows(dawWatcher.previewItems, removedRows);
+					ImportHelper::mergePreviewItems(dawWatcher.previewItems, addedRows);
+					onPreviewApplied(dawWatcher);
+				});
+		}
+
+		// Builds the tree of the items and their ancestors, including the status of the objects that already exist. Returns false when cancelled.
+		bool buildPreviewTree(const std::vector<Import::PreviewItem>& items, PreviewTree& previewTree)
+		{
+			std::set<juce::String> objectPaths;
+
+			addItemsToPreviewTree(items, previewTree, objectPaths);
+
+			if(isCancelled())
+				return false;
+
+			if(options.waapiConnected && options.importDestination.isNotEmpty())
+			{
+				postToMessageThread([](DawWatcher& dawWatcher)
+					{
+						dawWatcher.previewLoading = true;
+					});
+
+				auto response = getExistingObjects(objectPaths);
+
+				if(isCancelled())
+					return false;
+
+				if(response.status)
+					applyExistingObjects(previewTree, response.result);
+			}
+
+			return true;
+		}
+
+		juce::String getOriginalsWav(const Import::PreviewItem& importItem) const
+		{
+			return options.languageSubfolder + juce::File::getSeparatorChar() +
+			       (importItem.originalsSubFolder.isNotEmpty() ? importItem.originalsSubFolder + juce::File::getSeparatorChar() : "") +
+			       juce::File(importItem.audioFilePath).getFileName();
+		}
+
+		ImportHelper::PreviewItemRow getPreviewItemRow(const Import::PreviewItem& importItem) const
+		{
+			return {WwiseHelper::pathToPathWithoutObjectTypes(importItem.path), getOriginalsWav(importItem)};
+		}
+
+		// Adds the items and their ancestors to the tree and collects the paths of its objects
+		void addItemsToPreviewTree(const std::vector<Import::PreviewItem>& items, PreviewTree& previewTree, std::set<juce::String>& objectPaths)
+		{
+			const auto pathParts = WwiseHelper::pathToPathParts(WwiseHelper::pathToPathWithoutObjectTypes(options.importDestination) +
+																WwiseHelper::pathToPathWithoutObjectTypes(options.hierarchyMappingPath));
+
+			std::vector<PreviewTree::NodeIndex> wavNodes;
+			std::vector<juce::String> wavPaths;
+
+			for(const auto& importItem : items)
+			{
+				if(isCancelled())
+					return;
+
+				auto currentNode = PreviewTree::rootNode;
+				int depth = 0;
+
+				// Parsed once, names, types and ancestor paths are then views of the item path
+				const WwisePath::ParsedPath parsedPath(WwisePath::toStringView(importItem.path));
+				const auto numAncestors = parsedPath.size() > 0 ? parsedPath.size() - 1 : 0;
+
+				for(std::size_t i = 0; i < numAncestors; ++i)
+				{
+					auto name = WwisePath::toString(parsedPath.getName(i));
+
+					const auto numNodes = previewTree.getNumNodes();
+					auto child = previewTree.getOrAddChild(currentNode, name);
+
+					if(previewTree.getNumNodes() != numNodes)
+					{
+						const auto ancestorPath = parsedPath.getAncestorOrSelf(i);
+						objectPaths.insert(WwisePath::toStringWithoutObjectTypes(ancestorPath));
+
+						auto type = WwisePath::getObjectType(ancestorPath);
+
+						auto unresolvedWildcard = name.isEmpty() && pathParts[depth].isNotEmpty();
+
+						previewTree.setItem(child, {name, type, Import::ObjectStatus::New, "", Import::WavStatus::Unknown, unresolvedWildcard});
+					}
+
+					currentNode = child;
+					depth++;
+				}
+
+				auto pathWithoutType = WwiseHelper::pathToPathWithoutObjectTypes(importItem.path);
+				objectPaths.insert(pathWithoutType);
+
+				auto name = pathWithoutType.fromLastOccurrenceOf("\\", false, false);
+				auto type = WwisePath::getObjectType(parsedPath.getPath());
+
+				auto originalsWav = getOriginalsWav(importItem);
+
+				auto unresolvedWildcard = name.isEmpty() && pathParts[depth].isNotEmpty();
+
+				// Items resolving to the same object path are kept as separate rows, so that none of their audio files is hidden
+				auto child = previewTree.addChild(currentNode, name);
+				previewTree.setItem(child, {name, type, Import::ObjectStatus::New, originalsWav, Import::WavStatus::Unknown, unresolvedWildcard});
+
+				if(options.originalsFolder.isNotEmpty())
+				{
+					wavNodes.push_back(child);
+					wavPaths.push_back(juce::File(options.originalsFolder).getChildFile(originalsWav).getFullPathName());
+				}
+			}
+
+			// Resolved in a single pass so that each originals directory is listed once
+			const auto wavExists = DirectoryListingCache::getInstance().filesExist(wavPaths);
+
+			for(std::size_t i = 0; i < wavNodes.size(); ++i)
+			{
+				auto previewItem = previewTree.getItem(wavNodes[i]);
+				previewItem.wavStatus = wavExists[i] ? Import::WavStatus::Replaced : Import::WavStatus::New;
+				previewTree.setItem(wavNodes[i], previewItem);
+			}
+		}
+
+		Waapi::Response<Waapi::ObjectResponseSet> getExistingObjects(const std::set<juce::String>& objectPaths)
+		{
+			Waapi::Response<Waapi::ObjectResponseSet> response;
+			int attempt = 0;
+
+			auto onExecute = [this, &objectPaths, &response, &attempt]()
+			{
+				const WaapiMetrics::ScopedRetry scopedRetry(attempt++ > 0);
+
+				if(options.waqlEnabled)
+					response = dawWatcher.waapiClient.getObjectsByPaths(options.importDestination, objectPaths);
+				else
+					response = dawWatcher.waapiClient.getObjectAncestorsAndDescendantsLegacy(options.importDestination);
+
+				if(response.status)
+					return WaapiHelper::AttemptStatus::Succeeded;
+
+				return WaapiHelper::isTransientError(response.error) ? WaapiHelper::AttemptStatus::TransientFailure : WaapiHelper::AttemptStatus::PermanentFailure;
+			};
+
+			auto shouldStop = [this]()
+			{
+				return isCancelled();
+			};
+
+			WaapiHelper::executeWithRetry(onExecute, WaapiHelper::createRetryPolicy(WaapiHelper::getHeavyCallDeadlineMs(objectPaths.size())), shouldStop);
+
+			return response;
+		}
+
+		// Updates the status of the objects that already exist in Wwise
+		void applyExistingObjects(PreviewTree& previewTree, const Waapi::ObjectResponseSet& existingObjects)
+		{
+			for(const auto& existingObject : existingObjects)
+			{
+				for(auto node = previewTree.findNode(existingObject.path); node != PreviewTree::invalidNode; node = previewTree.getNextDuplicate(node))
+				{
+					auto previewItem = previewTree.getItem(node);
+
+					if(existingObject.type != Wwise::ObjectType::Sound || options.containerNameExists == Import::ContainerNameExistsOption::UseExisting)
+						previewItem.objectStatus = Import::ObjectStatus::NoChange;
+					else if(options.containerNameExists == Import::ContainerNameExistsOption::Replace)
+						previewItem.objectStatus = Import::ObjectStatus::Replaced;
+					else if(options.containerNameExists == Import::ContainerNameExistsOption::CreateNew)
+						previewItem.objectStatus = Import::ObjectStatus::NewRenamed;
+
+					if(previewItem.type == Wwise::ObjectType::Unknown)
+					{
+						previewItem.type = existingObject.type;
+					}
+
+					previewTree.setItem(node, previewItem);
+				}
+			}
+		}
 	};
 
 	DawWatcher::DawWatcher(juce::ValueTree appState, WaapiClient& waapiClient, DawContext& dawContext, int refreshInterval)
@@ -50,9 +338,9 @@ namespace AK::WwiseTransfer
 		, waapiConnected(appState, IDs::waapiConnected, nullptr)
 		, dawContext(dawContext)
 		, waapiClient(waapiClient)
-		, lastImportItemsHash(0)
 		, refreshInterval(refreshInterval)
 		, previewOptionsChanged(false)
+		, previewThreadPool(1)
 	{
 		auto featureSupport = appState.getChildWithName(IDs::featureSupport);
 		waqlEnabled.referTo(featureSupport, IDs::waqlEnabled, nullptr);
@@ -62,6 +350,11 @@ namespace AK::WwiseTransfer
 
 	DawWatcher::~DawWatcher()
 	{
+		if(previewCancellationToken != nullptr)
+			previewCancellationToken->cancel();
+
+		previewThreadPool.removeAllJobs(true, DawWatcherConstants::previewJobRemovalTimeoutMs);
+
 		applicationState.removeListener(this);
 	}
 
@@ -88,136 +381,23 @@ namespace AK::WwiseTransfer
 	void DawWatcher::handleAsyncUpdate()
 	{
 		const auto hierarchyMappingPath = ImportHelper::hierarchyMappingToPath(ImportHelper::valueTreeToHierarchyMappingNodeList(hierarchyMapping));
-		const auto importItems = dawContext.getItemsForPreview({importDestination, originalsSubfolder, hierarchyMappingPath});
+		auto importItems = dawContext.getItemsForPreview({importDestination, originalsSubfolder, hierarchyMappingPath});
 
-		const auto importItemsHash = ImportHelper::importPreviewItemsToHash(importItems);
+		PreviewOptions options{containerNameExists.get(), projectPath.get(), originalsFolder.get(), waqlEnabled.get(), languageSubfolder.get(),
+			importDestination.get(), hierarchyMappingPath, waapiConnected.get()};
 
-		if(importItemsHash != lastImportItemsHash || previewOptionsChanged)
-		{
-			auto pathParts = WwiseHelper::pathToPathParts(WwiseHelper::pathToPathWithoutObjectTypes(importDestination) +
-														  WwiseHelper::pathToPathWithoutObjectTypes(hierarchyMappingPath));
+		// The preview being built is cancelled below, so the next one has to be built even if the import items did not change
+		const auto forceRebuild = previewOptionsChanged || previewInProgress;
 
-			previewOptionsChanged = false;
+		previewOptionsChanged = false;
+		previewInProgress = true;
 
-			std::set<juce::String> objectPaths;
-			std::unordered_map<juce::String, juce::ValueTree> pathToValueTreeMapping;
+		if(previewCancellationToken != nullptr)
+			previewCancellationToken->cancel();
 
-			juce::ValueTree rootNode(IDs::previewItems);
+		previewCancellationToken = std::make_shared<WaapiHelper::CancellationToken>();
 
-			// Build tree based on import items and their ancestors
-			for(const auto& importItem : importItems)
-			{
-				auto currentNode = rootNode;
-				int depth = 0;
-
-				for(const auto& ancestorPath : WwiseHelper::pathToAncestorPaths(importItem.path))
-				{
-					auto pathWithoutType = WwiseHelper::pathToPathWithoutObjectTypes(ancestorPath);
-					auto child = currentNode.getChildWithName(pathWithoutType);
-
-					if(!child.isValid())
-					{
-						objectPaths.insert(pathWithoutType);
-
-						auto name = WwiseHelper::pathToObjectName(pathWithoutType);
-						auto type = WwiseHelper::pathToObjectType(ancestorPath);
-
-						auto unresolvedWildcard = name.isEmpty() && pathParts[depth].isNotEmpty();
-
-						Import::PreviewItemNode previewItemNode{name, type, Import::ObjectStatus::New, "", Import::WavStatus::Unknown, unresolvedWildcard};
-						child = ImportHelper::previewItemNodeToValueTree(pathWithoutType, previewItemNode);
-
-						currentNode.appendChild(child, nullptr);
-						pathToValueTreeMapping[pathWithoutType] = child;
-					}
-
-					currentNode = child;
-					depth++;
-				}
-
-				auto pathWithoutType = WwiseHelper::pathToPathWithoutObjectTypes(importItem.path);
-				objectPaths.insert(pathWithoutType);
-
-				auto name = WwiseHelper::pathToObjectName(importItem.path);
-				auto type = WwiseHelper::pathToObjectType(importItem.path);
-
-				auto originalsWav = languageSubfolder + juce::File::getSeparatorChar() +
-				                    (importItem.originalsSubFolder.isNotEmpty() ? importItem.originalsSubFolder + juce::File::getSeparatorChar() : "") +
-				                    juce::File(importItem.audioFilePath).getFileName();
-
-				auto wavStatus = Import::WavStatus::Unknown;
-
-				if(originalsFolder.get().isNotEmpty())
-				{
-					auto absoluteWavPath = juce::File(originalsFolder).getChildFile(originalsWav);
-
-					if(absoluteWavPath.exists())
-						wavStatus = Import::WavStatus::Replaced;
-					else
-						wavStatus = Import::WavStatus::New;
-				}
-
-				auto unresolvedWildcard = name.isEmpty() && pathParts[depth].isNotEmpty();
-
-				Import::PreviewItemNode previewItemNode{name, type, Import::ObjectStatus::New, originalsWav, wavStatus, unresolvedWildcard};
-				auto child = ImportHelper::previewItemNodeToValueTree(pathWithoutType, previewItemNode);
-
-				currentNode.appendChild(child, nullptr);
-				pathToValueTreeMapping[pathWithoutType] = child;
-			}
-
-			auto onGetObjectAncestorsAndDescendants = [this, pathToValueTreeMapping, rootNode](const Waapi::Response<Waapi::ObjectResponseSet>& response)
-			{
-				if(response.status)
-				{
-					// Update original tree with information from existing objects
-					for(const auto& existingObject : response.result)
-					{
-						auto it = pathToValueTreeMapping.find(existingObject.path);
-
-						if(it != pathToValueTreeMapping.end())
-						{
-							auto previewItem = ImportHelper::valueTreeToPreviewItemNode(it->second);
-
-							if(existingObject.type != Wwise::ObjectType::Sound || containerNameExists == Import::ContainerNameExistsOption::UseExisting)
-								previewItem.objectStatus = Import::ObjectStatus::NoChange;
-							else if(containerNameExists == Import::ContainerNameExistsOption::Replace)
-								previewItem.objectStatus = Import::ObjectStatus::Replaced;
-							else if(containerNameExists == Import::ContainerNameExistsOption::CreateNew)
-								previewItem.objectStatus = Import::ObjectStatus::NewRenamed;
-
-							if(previewItem.type == Wwise::ObjectType::Unknown)
-							{
-								previewItem.type = existingObject.type;
-							}
-
-							juce::ValueTree localCopy = it->second;
-							localCopy.copyPropertiesFrom(ImportHelper::previewItemNodeToValueTree(existingObject.path, previewItem), nullptr);
-						}
-					}
-				}
-
-				if(!previewItems.isEquivalentTo(rootNode))
-					previewItems.copyPropertiesAndChildrenFrom(rootNode, nullptr);
-
-				previewLoading = false;
-			};
-
-			if(waapiConnected.get() && importDestination.get().isNotEmpty())
-			{
-				previewLoading = true;
-
-				if(waqlEnabled)
-					waapiClient.getObjectAncestorsAndDescendantsAsync(importDestination, onGetObjectAncestorsAndDescendants);
-				else
-					waapiClient.getObjectAncestorsAndDescendantsLegacyAsync(importDestination, onGetObjectAncestorsAndDescendants);
-			}
-			else
-			{
-				Waapi::Response<Waapi::ObjectResponseSet> emptyResponse;
-				onGetObjectAncestorsAndDescendants(emptyResponse);
-			}
-		}
+		previewThreadPool.addJob(new PreviewJob(*this, std::move(options), std::move(importItems), forceRebuild, previewCancellationToken), true);
 	}
 
 	void DawWatcher::valueTreePropertyChanged(juce::ValueTree& treeWhosePropertyHasChanged, const juce::Identifier& property)
@@ -16,9 +16,11 @@ specific language governing permissions and limitations under the License.
 #pragma once
 
 #include "Core/DawContext.h"
+#include "Helpers/ImportHelper.h"
 #include "WaapiClient.h"
 
 #include <juce_gui_basics/juce_gui_basics.h>
+#include <memory>
 
 namespace AK::WwiseTransfer
 {
@@ -35,6 +37,21 @@ namespace AK::WwiseTransfer
 		void stop();
 
 	private:
+		class PreviewJob;
+
+		// Snapshot of the options a preview is built with, taken on the message thread
+		struct PreviewOptions
+		{
+			Import::ContainerNameExistsOption containerNameExists;
+			juce::String projectPath;
+			juce::String originalsFolder;
+			bool waqlEnabled;
+			juce::String languageSubfolder;
+			juce::String importDestination;
+			juce::String hierarchyMappingPath;
+			bool waapiConnected;
+		};
+
 		juce::ValueTree applicationState;
 		juce::ValueTree hierarchyMapping;
 		juce::ValueTree previewItems;
@@ -53,10 +70,18 @@ namespace AK::WwiseTransfer
 		DawContext& dawContext;
 		WaapiClient& waapiClient;
 
-		unsigned int lastImportItemsHash;
+		// Fingerprints of the items the current preview was built from. Only accessed by the preview thread.
+		ImportHelper::PreviewItemFingerprints lastPreviewItemFingerprints;
 		int refreshInterval;
 		bool previewOptionsChanged;
 
+		// Only the latest preview is applied, older ones are cancelled
+		bool previewInProgress{false};
+		std::shared_ptr<WaapiHelper::CancellationToken> previewCancellationToken;
+
+		// Parsing, hashing, file system probes and tree building happen on this thread to keep the message thread responsive
+		juce::ThreadPool previewThreadPool;
+
 		void timerCallback() override;
 		void valueTreePropertyChanged(juce::ValueTree& treeWhosePropertyHasChanged, const juce::Identifier& property) override;
 		void valueTreeChildAdded(juce::ValueTree& parentTree, juce::ValueTree& childWhichHasBeenAdded) override;
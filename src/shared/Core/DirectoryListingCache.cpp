@@ -0,0 +1,160 @@
+/*----------------------------------------------------------------------------------------
+
+Copyright (c) 2025 AUDIOKINETIC Inc.
+
+This file is licensed to use under the license available at:
+https://github.com/audiokinetic/ReaWwise/blob/main/License.txt (the "License").
+You may not use this file except in compliance with the License.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations under the License.
+
+----------------------------------------------------------------------------------------*/
+
+#include "DirectoryListingCache.h"
+
+#include <algorithm>
+
+#if !JUCE_WINDOWS
+#include <dirent.h>
+#endif
+
+namespace AK::WwiseTransfer
+{
+	namespace DirectoryListingCacheConstants
+	{
+		// Directory modification times may be as coarse as 2 seconds (FAT, some network shares). A listing taken within that window of
+		// the last modification could miss a later change that leaves the modification time untouched, so it is not trusted.
+		constexpr juce::int64 modificationTimeResolutionMs = 2000;
+
+		// Render and originals folders are few, this only keeps a long session from growing the cache without bound
+		constexpr std::size_t maxListings = 1024;
+	} // namespace DirectoryListingCacheConstants
+
+	DirectoryListingCache& DirectoryListingCache::getInstance()
+	{
+		static DirectoryListingCache instance;
+		return instance;
+	}
+
+	std::vector<bool> DirectoryListingCache::filesExist(const std::vector<juce::String>& filePaths)
+	{
+		std::vector<bool> result(filePaths.size(), false);
+
+		// Group the files by directory so that each directory is looked up once
+		std::unordered_map<juce::String, std::vector<std::size_t>> filesByDirectory;
+
+		for(std::size_t i = 0; i < filePaths.size(); ++i)
+			filesByDirectory[juce::File(filePaths[i]).getParentDirectory().getFullPathName()].push_back(i);
+
+		for(const auto& [directoryPath, fileIndices] : filesByDirectory)
+		{
+			const auto listing = getListing(juce::File(directoryPath));
+
+			if(listing == nullptr)
+				continue;
+
+			for(auto fileIndex : fileIndices)
+			{
+				const auto fileName = juce::File(filePaths[fileIndex]).getFileName();
+				result[fileIndex] = listing->fileNames.count(toFileNameKey(fileName)) > 0;
+			}
+		}
+
+		return result;
+	}
+
+	void DirectoryListingCache::clear()
+	{
+		std::lock_guard lock(mutex);
+		listings.clear();
+	}
+
+	std::shared_ptr<const DirectoryListingCache::Listing> DirectoryListingCache::getListing(const juce::File& directory)
+	{
+		using namespace DirectoryListingCacheConstants;
+
+		const auto directoryPath = directory.getFullPathName();
+		const auto directoryModificationTimeMs = directory.getLastModificationTime().toMilliseconds();
+
+		// Missing directories have no modification time
+		if(directoryModificationTimeMs == 0)
+		{
+			std::lock_guard lock(mutex);
+			listings.erase(directoryPath);
+
+			return nullptr;
+		}
+
+		{
+			std::lock_guard lock(mutex);
+
+			auto it = listings.find(directoryPath);
+
+			if(it != listings.end() &&
+				it->second->directoryModificationTimeMs == directoryModificationTimeMs &&
+				it->second->listingTimeMs - directoryModificationTimeMs > modificationTimeResolutionMs)
+			{
+				return it->second;
+			}
+		}
+
+		// Listing happens outside of the lock, concurrent listings of the same directory are harmless
+		auto listing = listDirectory(directory, directoryModificationTimeMs);
+
+		std::lock_guard lock(mutex);
+
+		if(listings.size() >= maxListings && listings.count(directoryPath) == 0)
+		{
+			auto isListedEarlier = [](const auto& lhs, const auto& rhs)
+			{
+				return lhs.second->listingTimeMs < rhs.second->listingTimeMs;
+			};
+
+			listings.erase(std::min_element(listings.begin(), listings.end(), isListedEarlier));
+		}
+
+		listings[directoryPath] = listing;
+
+		return listing;
+	}
+
+	std::shared_ptr<const DirectoryListingCache::Listing> DirectoryListingCache::listDirectory(const juce::File& directory, juce::int64 directoryModificationTimeMs)
+	{
+		auto listing = std::make_shared<Listing>();
+		listing->directoryModificationTimeMs = directoryModificationTimeMs;
+		listing->listingTimeMs = juce::Time::currentTimeMillis();
+
+#if JUCE_WINDOWS
+		// FindFirstFile/FindNextFile return the attributes along with the names, no extra call is made per file
+		for(const auto& entry : juce::RangedDirectoryIterator(directory, false, "*", juce::File::findFilesAndDirectories))
+			listing->fileNames.insert(toFileNameKey(entry.getFile().getFileName()));
+#else
+		// juce::DirectoryIterator stats every entry to fill in its attributes, only the names are needed here
+		if(auto* dir = opendir(directory.getFullPathName().toRawUTF8()))
+		{
+			while(auto* entry = readdir(dir))
+			{
+				const auto fileName = juce::String::fromUTF8(entry->d_name);
+
+				if(fileName != "." && fileName != "..")
+					listing->fileNames.insert(toFileNameKey(fileName));
+			}
+
+			closedir(dir);
+		}
+#endif
+
+		return listing;
+	}
+
+	juce::String DirectoryListingCache::toFileNameKey(const juce::String& fileName)
+	{
+		if constexpr(isCaseInsensitive)
+			return fileName.toLowerCase();
+		else
+			return fileName;
+	}
+} // namespace AK::WwiseTransfer
@@ -0,0 +1,63 @@
+/*----------------------------------------------------------------------------------------
+
+Copyright (c) 2025 AUDIOKINETIC Inc.
+
+This file is licensed to use under the license available at:
+https://github.com/audiokinetic/ReaWwise/blob/main/License.txt (the "License").
+You may not use this file except in compliance with the License.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations under the License.
+
+----------------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace AK::WwiseTransfer
+{
+	// Answers file existence queries by listing each parent directory once instead of querying every file, which is slow on network drives.
+	// Listings are cached until the modification time of their directory changes. The least recently listed directories are dropped past a fixed count.
+	class DirectoryListingCache
+	{
+	public:
+		static DirectoryListingCache& getInstance();
+
+		// Returns whether each of the files exists. Files must have absolute paths.
+		std::vector<bool> filesExist(const std::vector<juce::String>& filePaths);
+
+		void clear();
+
+		// Whether names differing only by case refer to the same file on this platform's default file system
+		static constexpr bool isCaseInsensitive =
+#if JUCE_WINDOWS || JUCE_MAC
+			true;
+#else
+			false;
+#endif
+
+	private:
+		struct Listing
+		{
+			juce::int64 directoryModificationTimeMs{0};
+			juce::int64 listingTimeMs{0};
+			std::unordered_set<juce::String> fileNames;
+		};
+
+		std::shared_ptr<const Listing> getListing(const juce::File& directory);
+
+		static std::shared_ptr<const Listing> listDirectory(const juce::File& directory, juce::int64 directoryModificationTimeMs);
+		static juce::String toFileNameKey(const juce::String& fileName);
+
+		std::mutex mutex;
+		std::unordered_map<juce::String, std::shared_ptr<const Listing>> listings;
+	};
+} // namespace AK::WwiseTransfer
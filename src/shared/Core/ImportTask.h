@@ -15,10 +15,23 @@ specific language governing permissions and limitations under the License.
 
 #pragma once
 
+#include "AudioFileEncoder.h"
+#include "DirectoryListingCache.h"
+#include "Helpers/Base64Helper.h"
 #include "Helpers/ImportHelper.h"
+#include "Helpers/WwisePath.h"
 #include "Model/Import.h"
+#include "RenderWatcher.h"
 #include "WaapiClient.h"
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace AK::WwiseTransfer
@@ -26,23 +39,70 @@ namespace AK::WwiseTransfer
 	namespace ImportTaskContants
 	{
 		const juce::String defaultObjectLanguage = "SFX";
-	}
 
-	template <class Callback>
-	class ImportTask : public juce::ThreadWithProgressWindow
+		// Keeps each audio.import request well below the WAAPI message size limit, and gives the progress bar something to report
+		constexpr std::size_t maxItemsPerImportBatch = 250;
+		constexpr std::size_t maxBytesPerImportBatch = 8 * 1024 * 1024;
+
+		// Leaves room for the batch being sent and the next one being encoded
+		constexpr std::size_t audioFileEncoderMemoryBudget = 4 * maxBytesPerImportBatch;
+		constexpr int maxAudioFileEncoderThreads = 4;
+
+		constexpr int renderWatcherWaitTimeoutMs = 100;
+
+		// How often the progress window checks whether the user cancelled while the import runs on its own thread
+		constexpr int cancellationPollIntervalMs = 50;
+
+		// How long destroying the task waits for the import to reach its next checkpoint
+		constexpr int threadExitTimeoutMs = 2000;
+	} // namespace ImportTaskContants
+
+	// Owns everything the import needs and runs it on a thread of its own, so that the task showing its progress can be destroyed without waiting for it.
+	// The summary only reaches the callback while that task is alive.
+	class ImportTaskWorker final : public std::enable_shared_from_this<ImportTaskWorker>
 	{
 	public:
-		ImportTask(WaapiClient& waapiClient, const Import::Task::Options& options, Callback callback)
-			: juce::ThreadWithProgressWindow("Importing...", true, false)
-			, waapiClient(waapiClient)
+		using Callback = std::function<void(const Import::Summary&)>;
+
+		ImportTaskWorker(WaapiClient& waapiClient, const Import::Task::Options& options, Callback callback, std::shared_ptr<RenderWatcher> renderWatcher)
+			: waapiClient(waapiClient)
 			, options(options)
-			, callback(callback)
+			, callback(std::move(callback))
+			, renderWatcher(std::move(renderWatcher))
+			, cancellationToken(std::make_shared<WaapiHelper::CancellationToken>())
 		{
-			// Set progress to -1 one to show infinite progress bar
-			setProgress(-1);
 		}
 
-		void run() override
+		bool start()
+		{
+			auto onRun = [worker = shared_from_this()]
+			{
+				worker->import();
+				worker->finished.signal();
+			};
+
+			return juce::Thread::launch(onRun);
+		}
+
+		bool waitForFinish(int timeoutMs)
+		{
+			return finished.wait(timeoutMs);
+		}
+
+		void cancel()
+		{
+			cancellationToken->cancel();
+		}
+
+		// Called on the message thread, where the posted summary checks it before calling back
+		void detach()
+		{
+			detached = true;
+			cancel();
+		}
+
+	private:
+		void import()
 		{
 			using namespace AK::WwiseAuthoringAPI;
 
@@ -55,34 +115,68 @@ namespace AK::WwiseTransfer
 
 			std::vector<Waapi::ImportItemRequest> importItemRequests;
 
+			// The render watcher reports import item indices, items with an incomplete path have no request
+			constexpr auto noImportItemRequest = std::numeric_limits<std::size_t>::max();
+			std::vector<std::size_t> importItemRequestIndices(options.importItems.size(), noImportItemRequest);
+
 			// Holds all paths to objects defined in the extension (including ancestors)
 			std::set<ObjectPath> objectsInExtension;
 
-			for(const auto& importItem : options.importItems)
+			for(std::size_t i = 0; i < options.importItems.size(); ++i)
 			{
+				const auto& importItem = options.importItems[i];
+
 				if(WwiseHelper::isPathComplete(importItem.path))
 				{
-					importItemRequests.emplace_back(Waapi::ImportItemRequest{importItem.path, importItem.originalsSubFolder, importItem.renderFilePath, importItem.renderFileWavBase64, importItem.renderFileName});
+					importItemRequestIndices[i] = importItemRequests.size();
+
+					auto& importItemRequest = importItemRequests.emplace_back(Waapi::ImportItemRequest{importItem.path, importItem.originalsSubFolder, importItem.renderFilePath, importItem.renderFileName});
+
+					// Payloads are only encoded when their batch is about to be sent, the expected size is enough to build the batches
+					if(options.crossMachineTransferEnabled && !renderWatcher)
+						importItemRequest.renderFileWavBase64Size = Base64Helper::getEncodedSize(static_cast<std::size_t>(juce::File(importItem.renderFilePath).getSize()));
 
 					auto pathWithoutObjectTypes = WwiseHelper::pathToPathWithoutObjectTypes(importItem.path);
 					objectsInExtension.insert(pathWithoutObjectTypes);
 
-					for(const auto& ancestorPath : WwiseHelper::pathToAncestorPaths(pathWithoutObjectTypes))
-						objectsInExtension.insert(ancestorPath);
+					// Items share most of their ancestors. Going up from the parent, the first ancestor already known means the rest are known too.
+					const WwisePath::ParsedPath parsedPath(WwisePath::toStringView(pathWithoutObjectTypes));
+
+					for(auto partIndex = parsedPath.size(); partIndex-- > 1;)
+					{
+						if(!objectsInExtension.insert(WwisePath::toRootedString(parsedPath.getAncestorOrSelf(partIndex - 1))).second)
+							break;
+					}
 				}
 				else
 					juce::Logger::writeToLog("File with incomplete object path " + importItem.path + " will not be imported.");
 			}
 
-			if(!importItemRequests.empty())
+			if(!importItemRequests.empty() && !shouldCancel(summary))
 			{
 				// Will be eventullay compared to the results of the import to figure out what was newly created
 				Waapi::Response<Waapi::ObjectResponseSet> existingObjectsResponse;
 
-				if(options.waqlEnabled)
-					existingObjectsResponse = waapiClient.getObjectAncestorsAndDescendants(options.importDestination);
-				else
-					existingObjectsResponse = waapiClient.getObjectAncestorsAndDescendantsLegacy(options.importDestination);
+				auto onExecute = [this, &objectsInExtension, &existingObjectsResponse]()
+				{
+					// Only the objects defined in the extension are needed, no need to fetch the whole destination subtree
+					if(options.waqlEnabled)
+						existingObjectsResponse = waapiClient.getObjectsByPaths(options.importDestination, objectsInExtension);
+					else
+						existingObjectsResponse = waapiClient.getObjectAncestorsAndDescendantsLegacy(options.importDestination);
+
+					if(existingObjectsResponse.status)
+						return WaapiHelper::AttemptStatus::Succeeded;
+
+					return WaapiHelper::isTransientError(existingObjectsResponse.error) ? WaapiHelper::AttemptStatus::TransientFailure : WaapiHelper::AttemptStatus::PermanentFailure;
+				};
+
+				auto isCancelled = [this]()
+				{
+					return cancellationToken->isCancelled();
+				};
+
+				WaapiHelper::executeWithRetry(onExecute, WaapiHelper::createRetryPolicy(WaapiHelper::getHeavyCallDeadlineMs(objectsInExtension.size())), isCancelled);
 
 				if(existingObjectsResponse.status)
 				{
@@ -112,47 +206,246 @@ namespace AK::WwiseTransfer
 
 					// Check if wav files will be replaced. Only works if we have the originals folder.
 					// Basically checks to see if the audio file is already present in the originals folder.
-					std::set<juce::String> existingAudioFiles;
+					std::unordered_set<juce::String> existingAudioFiles;
 
-					if(options.originalsFolder.isNotEmpty())
+					if(options.originalsFolder.isNotEmpty() && !shouldCancel(summary))
 					{
+						std::vector<juce::String> pathsInWwise;
+						pathsInWwise.reserve(importItemRequests.size());
+
 						for(const auto& importItemRequest : importItemRequests)
 						{
 							// Build the final file path
-							auto pathInWwise = options.originalsFolder + options.languageSubfolder + juce::File::getSeparatorString() +
-							                   (importItemRequest.originalsSubFolder.isNotEmpty() ? importItemRequest.originalsSubFolder + juce::File::getSeparatorString() : "") +
-							                   juce::File(importItemRequest.renderFilePath).getFileName();
+							pathsInWwise.emplace_back(options.originalsFolder + options.languageSubfolder + juce::File::getSeparatorString() +
+							                          (importItemRequest.originalsSubFolder.isNotEmpty() ? importItemRequest.originalsSubFolder + juce::File::getSeparatorString() : "") +
+							                          juce::File(importItemRequest.renderFilePath).getFileName());
+						}
+
+						// Each originals directory is listed once instead of querying every file
+						const auto pathsInWwiseExist = DirectoryListingCache::getInstance().filesExist(pathsInWwise);
+
+						// Several objects may share the same audio file
+						std::unordered_map<juce::String, std::vector<const Waapi::ObjectResponse*>> existingObjectsByOriginalWavFilePath;
+
+						auto addExistingObjects = [&existingObjectsByOriginalWavFilePath](const Waapi::ObjectResponseSet& existingObjects)
+						{
+							for(const auto& existingObject : existingObjects)
+							{
+								if(existingObject.originalWavFilePath.isNotEmpty())
+									existingObjectsByOriginalWavFilePath[existingObject.originalWavFilePath].push_back(&existingObject);
+							}
+						};
+
+						addExistingObjects(existingObjectsResponse.result);
+
+						// The path query only returns the objects being imported, other sounds of the destination may use the same audio files.
+						// Only audio files already in the originals folder can be used by existing sounds.
+						std::vector<juce::String> existingPathsInWwise;
+
+						for(std::size_t i = 0; i < pathsInWwise.size(); ++i)
+						{
+							if(pathsInWwiseExist[i])
+								existingPathsInWwise.push_back(pathsInWwise[i]);
+						}
+
+						Waapi::Response<Waapi::ObjectResponseSet> soundsResponse;
+
+						if(options.waqlEnabled && !existingPathsInWwise.empty())
+						{
+							const WaapiHelper::ScopedCallDeadline scopedCallDeadline(WaapiHelper::getDeadlineFromNow(WaapiHelper::getHeavyCallDeadlineMs(existingPathsInWwise.size())));
+							soundsResponse = waapiClient.getSoundsByOriginalWavFilePaths(options.importDestination, existingPathsInWwise);
+
+							if(soundsResponse.status)
+								addExistingObjects(soundsResponse.result);
+							else
+								summary.errors.push_back(soundsResponse.error);
+						}
 
-							if(juce::File(pathInWwise).exists())
+						for(std::size_t i = 0; i < pathsInWwise.size(); ++i)
+						{
+							const auto& pathInWwise = pathsInWwise[i];
+
+							if(pathsInWwiseExist[i])
 								existingAudioFiles.emplace(pathInWwise);
 
-							for(const auto& existingObject : existingObjectsResponse.result)
+							auto it = existingObjectsByOriginalWavFilePath.find(pathInWwise);
+
+							if(it == existingObjectsByOriginalWavFilePath.end())
+								continue;
+
+							for(const auto* existingObject : it->second)
+							{
+								auto& summaryObject = summary.objects[existingObject->path];
+								summaryObject.id = existingObject->id;
+								summaryObject.originalWavFilePath = pathInWwise;
+								summaryObject.wavStatus = Import::WavStatus::Replaced;
+								summaryObject.type = existingObject->type;
+							}
+						}
+					}
+
+					// Merged results of all successful batches. Objects shared by several batches (containers) are only kept once.
+					Waapi::ObjectResponseSet importedObjects;
+					bool anyBatchSucceeded = false;
+
+					const auto numImportItemRequests = importItemRequests.size();
+					std::size_t numImportItemRequestsSent = 0;
+
+					std::unique_ptr<AudioFileEncoder> audioFileEncoder;
+
+					if(options.crossMachineTransferEnabled)
+					{
+						audioFileEncoder = std::make_unique<AudioFileEncoder>(ImportTaskContants::audioFileEncoderMemoryBudget,
+							juce::jmin(ImportTaskContants::maxAudioFileEncoderThreads, juce::SystemStats::getNumCpus()), cancellationToken);
+					}
+
+					auto importRequests = [&](std::vector<Waapi::ImportItemRequest> requests)
+					{
+						auto importItemRequestBatches = ImportHelper::splitImportItemRequestsIntoBatches(std::move(requests),
+							ImportTaskContants::maxItemsPerImportBatch,
+							ImportTaskContants::maxBytesPerImportBatch);
+
+						std::shared_ptr<AudioFileEncoder::EncodingBatch> encodingBatch;
+
+						if(audioFileEncoder && !importItemRequestBatches.empty())
+							encodingBatch = audioFileEncoder->encodeAsync(importItemRequestBatches.front());
+
+						for(std::size_t batchIndex = 0; batchIndex < importItemRequestBatches.size(); ++batchIndex)
+						{
+							auto& importItemRequestBatch = importItemRequestBatches[batchIndex];
+
+							// The batch being encoded still points to its requests, the encoder stops early once cancelled
+							std::vector<juce::String> failedFiles;
+
+							if(audioFileEncoder)
+								failedFiles = audioFileEncoder->waitForCompletion(encodingBatch);
+
+							if(shouldCancel(summary))
+							{
+								if(audioFileEncoder)
+									audioFileEncoder->release(importItemRequestBatch);
+
+								for(auto it = importItemRequestBatches.begin() + batchIndex; it != importItemRequestBatches.end(); ++it)
+									addNotImportedFiles(summary, *it);
+
+								break;
+							}
+
+							numImportItemRequestsSent += importItemRequestBatch.size();
+
+							setStatusMessage("Importing files " + juce::String(numImportItemRequestsSent) + " of " + juce::String(numImportItemRequests) + "...");
+
+							if(audioFileEncoder)
+							{
+								// Encode the next batch while this one is being sent
+								if(batchIndex + 1 < importItemRequestBatches.size())
+									encodingBatch = audioFileEncoder->encodeAsync(importItemRequestBatches[batchIndex + 1]);
+
+								if(!failedFiles.empty())
+								{
+									summary.errors.push_back(createEncodingError(failedFiles));
+
+									auto isNotEncoded = [](const Waapi::ImportItemRequest& importItemRequest)
+									{
+										return importItemRequest.renderFileWavBase64.empty();
+									};
+
+									importItemRequestBatch.erase(std::remove_if(importItemRequestBatch.begin(), importItemRequestBatch.end(), isNotEncoded), importItemRequestBatch.end());
+								}
+							}
+
+							// Every file of the batch may have failed to encode, the errors were already reported in that case
+							if(!importItemRequestBatch.empty())
 							{
-								if(existingObject.originalWavFilePath == pathInWwise)
+								// Bounded so that a batch Wwise never answers does not hold the import thread forever
+								const WaapiHelper::ScopedCallDeadline scopedCallDeadline(WaapiHelper::getDeadlineFromNow(WaapiHelper::getHeavyCallDeadlineMs(importItemRequestBatch.size())));
+								auto importResponse = waapiClient.import(importItemRequestBatch, options.containerNameExistsOption, objectLanguage);
+
+								if(importResponse.status)
+								{
+									importedObjects.merge(importResponse.result);
+									anyBatchSucceeded = true;
+								}
+								else
 								{
-									auto& summaryObject = summary.objects[existingObject.path];
-									summaryObject.id = existingObject.id;
-									summaryObject.originalWavFilePath = pathInWwise;
-									summaryObject.wavStatus = Import::WavStatus::Replaced;
-									summaryObject.type = existingObject.type;
+									// Keep going, the remaining batches are independent from the one that failed
+									juce::Logger::writeToLog("Import batch failed: " + importResponse.error.message);
+									summary.errors.push_back(importResponse.error);
 								}
 							}
+
+							if(audioFileEncoder)
+								audioFileEncoder->release(importItemRequestBatch);
+
+							setProgress(static_cast<double>(numImportItemRequestsSent) / numImportItemRequests);
+						}
+					};
+
+					if(renderWatcher)
+					{
+						setStatusMessage("Waiting for rendered files...");
+
+						std::vector<std::size_t> renderedImportItems;
+
+						// Files are imported as soon as they are rendered, while the rest of the render goes on
+						while(!shouldCancel(summary) && renderWatcher->waitForRenderedTargets(renderedImportItems, ImportTaskContants::renderWatcherWaitTimeoutMs))
+						{
+							std::vector<Waapi::ImportItemRequest> renderedImportItemRequests;
+
+							for(const auto importItemIndex : renderedImportItems)
+							{
+								const auto importItemRequestIndex = importItemRequestIndices[importItemIndex];
+
+								if(importItemRequestIndex == noImportItemRequest)
+									continue;
+
+								auto& importItemRequest = renderedImportItemRequests.emplace_back(std::move(importItemRequests[importItemRequestIndex]));
+								importItemRequestIndices[importItemIndex] = noImportItemRequest;
+
+								// The render file may have been renamed by the DAW to avoid overwriting an existing file
+								const auto& renderFile = renderWatcher->getRenderFile(importItemIndex);
+								importItemRequest.renderFilePath = renderFile.getFullPathName();
+								importItemRequest.renderFileName = renderFile.getFileName();
+
+								if(options.crossMachineTransferEnabled)
+									importItemRequest.renderFileWavBase64Size = Base64Helper::getEncodedSize(static_cast<std::size_t>(renderFile.getSize()));
+							}
+
+							renderedImportItems.clear();
+
+							if(!renderedImportItemRequests.empty())
+								importRequests(std::move(renderedImportItemRequests));
 						}
-					}
 
-					auto importResponse = waapiClient.import(importItemRequests, options.containerNameExistsOption, objectLanguage);
+						// Rendered or not, the remaining files were never handed to the import
+						if(summary.cancelled)
+						{
+							for(const auto importItemRequestIndex : importItemRequestIndices)
+							{
+								if(importItemRequestIndex != noImportItemRequest)
+									summary.notImportedFiles.emplace_back(importItemRequests[importItemRequestIndex].renderFilePath);
+							}
+						}
+
+						const auto failedRenderTargets = renderWatcher->getFailedTargets();
+
+						if(!failedRenderTargets.empty())
+							summary.errors.push_back(createRenderError(failedRenderTargets));
+					}
+					else
+						importRequests(std::move(importItemRequests));
 
-					if(importResponse.status)
+					if(anyBatchSucceeded)
 					{
 						// Result will include newly created and existing (affected) objects
-						for(const auto& object : importResponse.result)
+						for(const auto& object : importedObjects)
 						{
 							// Check against existing objects to see if object was truely newly created
-							auto it = summary.objects.find(object.path);
+							auto [it, inserted] = summary.objects.try_emplace(object.path);
+							auto& summaryObject = it->second;
 
-							if(it == summary.objects.end())
+							if(inserted)
 							{
-								auto& summaryObject = summary.objects[object.path];
 								summaryObject.objectStatus = Import::ObjectStatus::New;
 								summaryObject.type = object.type;
 								summaryObject.originalWavFilePath = object.originalWavFilePath;
@@ -160,31 +453,30 @@ namespace AK::WwiseTransfer
 								if(object.originalWavFilePath.isNotEmpty())
 								{
 									// Some objects are associated with an originalWavFilePath that may have been replaced.
-									auto it = existingAudioFiles.find(object.originalWavFilePath);
-									if(it != existingAudioFiles.end())
+									if(existingAudioFiles.count(object.originalWavFilePath) > 0)
 									{
-										summary.objects[object.path].wavStatus = Import::WavStatus::Replaced;
+										summaryObject.wavStatus = Import::WavStatus::Replaced;
 									}
 									else
 									{
-										summary.objects[object.path].wavStatus = Import::WavStatus::New;
+										summaryObject.wavStatus = Import::WavStatus::New;
 									}
 								}
 							}
 							// If the object was found but the id is different, it was replaced
-							else if(it->second.id != object.id)
+							else if(summaryObject.id != object.id)
 							{
-								summary.objects[object.path].objectStatus = Import::ObjectStatus::Replaced;
+								summaryObject.objectStatus = Import::ObjectStatus::Replaced;
 							}
 						}
 
 						// Applying templates only works in custom hierarchy mapping mode
-						if(options.applyTemplateFeatureEnabled)
+						if(options.applyTemplateFeatureEnabled && !shouldCancel(summary))
 						{
 							// Will store node depth in relation to template property path
 							std::map<int, juce::String> depthToTemplatePropertyPathMap;
 
-							int importDestinationDepth = WwiseHelper::pathToPathParts(options.importDestination).size();
+							int importDestinationDepth = WwiseHelper::getPathDepth(options.importDestination);
 
 							for(int i = 0; i < options.hierarchyMappingNodeList.size(); ++i)
 							{
@@ -202,20 +494,33 @@ namespace AK::WwiseTransfer
 							{
 								std::map<PropertyTemplatePath, std::vector<ObjectPath>> propertyTemplatePathToObjectMapping;
 
-								// Go through all objects and if their depth matches a hierarchy node that has a template defined in it, add it to propertyTemplatePathToObjectMapping
-								// We will eventually use this map to submit paste property requests in waaapi
+								// Group the objects that may receive a template by depth, each object path is only parsed once
+								std::unordered_map<int, std::vector<ObjectPath>> depthToObjectsMap;
+
 								for(const auto& [objectPath, object] : summary.objects)
 								{
-									const int depth = WwiseHelper::pathToPathParts(objectPath).size();
+									if(options.applyTemplateOption == Import::ApplyTemplateOption::Always || object.objectStatus == Import::ObjectStatus::New)
+										depthToObjectsMap[WwiseHelper::getPathDepth(objectPath)].emplace_back(objectPath);
+								}
+
+								// Objects whose depth matches a hierarchy node that has a template defined in it are added to propertyTemplatePathToObjectMapping
+								// We will eventually use this map to submit paste property requests in waaapi
+								for(const auto& [depth, propertyTemplatePath] : depthToTemplatePropertyPathMap)
+								{
+									auto it = depthToObjectsMap.find(depth);
 
-									auto it = depthToTemplatePropertyPathMap.find(depth);
+									if(it == depthToObjectsMap.end())
+										continue;
 
-									if(it != depthToTemplatePropertyPathMap.end() && (options.applyTemplateOption == Import::ApplyTemplateOption::Always || object.objectStatus == Import::ObjectStatus::New))
-										propertyTemplatePathToObjectMapping[it->second].emplace_back(objectPath);
+									auto& targets = propertyTemplatePathToObjectMapping[propertyTemplatePath];
+									targets.insert(targets.end(), std::make_move_iterator(it->second.begin()), std::make_move_iterator(it->second.end()));
 								}
 
 								for(const auto& [source, targets] : propertyTemplatePathToObjectMapping)
 								{
+									if(shouldCancel(summary))
+										break;
+
 									const auto response = waapiClient.pasteProperties({source, targets});
 									if(!response.status)
 									{
@@ -230,41 +535,93 @@ namespace AK::WwiseTransfer
 							}
 						}
 
-						if(importResponse.result.size() > 0)
+						if(importedObjects.size() > 0 && !shouldCancel(summary))
 						{
 							std::vector<juce::String> importedObjectPaths;
 
-							// Assumes that importResponse.result is sorted by path
-							auto first = importResponse.result.begin()->path;
-							auto last = importResponse.result.rbegin()->path;
+							// Assumes that importedObjects is sorted by path
+							auto first = importedObjects.begin()->path;
+							auto last = importedObjects.rbegin()->path;
 
 							importedObjectPaths.emplace_back(WwiseHelper::getCommonAncestor(first, last));
 
 							waapiClient.selectObjects(options.selectObjectsOnImportCommand, importedObjectPaths);
 						}
 					}
-					else
-					{
-						summary.errors.push_back(importResponse.error);
-					}
 				}
 				else
 				{
 					summary.errors.push_back(existingObjectsResponse.error);
 				}
 			}
+			else if(summary.cancelled)
+				addNotImportedFiles(summary, importItemRequests);
 			else
 				juce::Logger::writeToLog("Import items list was empty. Nothing to import.");
 
-			auto onCallAsync = [this, summary = summary]
+			if(summary.cancelled)
+				juce::Logger::writeToLog("Import cancelled. " + juce::String(summary.notImportedFiles.size()) + " file(s) were not imported.");
+
+			auto onCallAsync = [worker = shared_from_this(), summary = summary]
 			{
-				callback(summary);
+				if(!worker->detached)
+					worker->callback(summary);
 			};
 
 			juce::MessageManager::callAsync(onCallAsync);
 		}
 
-	private:
+		// Checked between phases and batches
+		bool shouldCancel(Import::Summary& summary)
+		{
+			if(cancellationToken->isCancelled())
+				summary.cancelled = true;
+
+			return summary.cancelled;
+		}
+
+		static void addNotImportedFiles(Import::Summary& summary, const std::vector<Waapi::ImportItemRequest>& importItemRequests)
+		{
+			for(const auto& importItemRequest : importItemRequests)
+				summary.notImportedFiles.emplace_back(importItemRequest.renderFilePath);
+		}
+
+		static Waapi::Error createEncodingError(const std::vector<juce::String>& failedFiles)
+		{
+			auto raw = std::make_unique<juce::DynamicObject>();
+			juce::Array<juce::var> files;
+
+			for(const auto& failedFile : failedFiles)
+			{
+				juce::Logger::writeToLog("Could not read render file " + failedFile + " for cross machine transfer. It will not be imported.");
+				files.add(failedFile);
+			}
+
+			const juce::String message = "Could not read render files for cross machine transfer";
+			raw->setProperty("message", message);
+			raw->setProperty("files", files);
+
+			return Waapi::Error{{}, "Cross Machine Transfer", message, juce::JSON::toString(juce::var(raw.release()))};
+		}
+
+		static Waapi::Error createRenderError(const std::vector<juce::File>& failedRenderTargets)
+		{
+			auto raw = std::make_unique<juce::DynamicObject>();
+			juce::Array<juce::var> files;
+
+			for(const auto& failedRenderTarget : failedRenderTargets)
+			{
+				juce::Logger::writeToLog("Render file " + failedRenderTarget.getFullPathName() + " was not rendered. It will not be imported.");
+				files.add(failedRenderTarget.getFullPathName());
+			}
+
+			const juce::String message = "One or more files failed to render";
+			raw->setProperty("message", message);
+			raw->setProperty("files", files);
+
+			return Waapi::Error{{}, "Render", message, juce::JSON::toString(juce::var(raw.release()))};
+		}
+
 		struct ScopedUndoGroup final
 		{
 			WaapiClient& waapiClient;
@@ -288,5 +645,57 @@ namespace AK::WwiseTransfer
 		WaapiClient& waapiClient;
 		Import::Task::Options options;
 		Callback callback;
+		std::shared_ptr<RenderWatcher> renderWatcher;
+		std::shared_ptr<WaapiHelper::CancellationToken> cancellationToken;
+		std::atomic<bool> detached{false};
+
+		// Manual reset, every wait made after the import finished returns right away
+		juce::WaitableEvent finished{true};
+	};
+
+	template <class Callback>
+	class ImportTask : public juce::ThreadWithProgressWindow
+	{
+	public:
+		// When a render watcher is given, the render files do not exist yet. Each file is imported as soon as the watcher reports it rendered.
+		ImportTask(WaapiClient& waapiClient, const Import::Task::Options& options, Callback callback, std::shared_ptr<RenderWatcher> renderWatcher = nullptr)
+			: juce::ThreadWithProgressWindow("Importing...", true, true)
+			, worker(std::make_shared<ImportTaskWorker>(waapiClient, options, std::move(callback), std::move(renderWatcher)))
+		{
+			// Set progress to -1 one to show infinite progress bar
+			setProgress(-1);
+		}
+
+		// Never blocks the message thread for long. An import still running past the timeout finishes on its own and its summary is dropped.
+		~ImportTask() override
+		{
+			worker->detach();
+			worker->waitForFinish(ImportTaskContants::threadExitTimeoutMs);
+
+			stopThread(ImportTaskContants::threadExitTimeoutMs);
+		}
+
+		// The import runs on its own thread. When cancelled, the progress window closes right away without blocking the message thread,
+		// and the import stops at its next checkpoint before reporting what was imported.
+		void run() override
+		{
+			if(!worker->start())
+			{
+				juce::Logger::writeToLog("Could not start the import thread.");
+				return;
+			}
+
+			while(!worker->waitForFinish(ImportTaskContants::cancellationPollIntervalMs))
+			{
+				if(threadShouldExit())
+				{
+					worker->cancel();
+					return;
+				}
+			}
+		}
+
+	private:
+		std::shared_ptr<ImportTaskWorker> worker;
 	};
 } // namespace AK::WwiseTransfer
@@ -0,0 +1,233 @@
+/*----------------------------------------------------------------------------------------
+
+Copyright (c) 2025 AUDIOKINETIC Inc.
+
+This file is licensed to use under the license available at:
+https://github.com/audiokinetic/ReaWwise/blob/main/License.txt (the "License").
+You may not use this file except in compliance with the License.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations under the License.
+
+----------------------------------------------------------------------------------------*/
+
+#include "PreviewTree.h"
+
+#include "Helpers/ImportHelper.h"
+
+namespace AK::WwiseTransfer
+{
+	PreviewTree::PreviewTree()
+	{
+		clear();
+	}
+
+	PreviewTree::NodeIndex PreviewTree::getOrAddChild(NodeIndex parent, const juce::String& name)
+	{
+		jassert(parent < nodes.size());
+
+		const auto nameIndex = internName(name);
+		const auto [it, inserted] = childIndices.try_emplace(getChildKey(parent, nameIndex), static_cast<NodeIndex>(nodes.size()));
+
+		if(!inserted)
+			return it->second;
+
+		return appendChild(parent, nameIndex);
+	}
+
+	PreviewTree::NodeIndex PreviewTree::addChild(NodeIndex parent, const juce::String& name)
+	{
+		jassert(parent < nodes.size());
+
+		const auto nameIndex = internName(name);
+		const auto [it, inserted] = childIndices.try_emplace(getChildKey(parent, nameIndex), static_cast<NodeIndex>(nodes.size()));
+
+		const auto child = appendChild(parent, nameIndex);
+
+		if(!inserted)
+		{
+			auto duplicate = it->second;
+
+			while(nodes[duplicate].nextDuplicate != invalidNode)
+				duplicate = nodes[duplicate].nextDuplicate;
+
+			nodes[duplicate].nextDuplicate = child;
+		}
+
+		return child;
+	}
+
+	PreviewTree::NodeIndex PreviewTree::findNode(const juce::String& objectPath) const
+	{
+		if(!objectPath.startsWithChar('\\'))
+			return invalidNode;
+
+		auto node = rootNode;
+
+		for(int start = 1; node != invalidNode;)
+		{
+			const auto end = objectPath.indexOfChar(start, '\\');
+			const auto nameIndex = findName(objectPath.substring(start, end < 0 ? objectPath.length() : end));
+
+			if(nameIndex == names.size())
+				return invalidNode;
+
+			const auto it = childIndices.find(getChildKey(node, nameIndex));
+			node = it != childIndices.end() ? it->second : invalidNode;
+
+			if(end < 0)
+				break;
+
+			start = end + 1;
+		}
+
+		return node;
+	}
+
+	juce::String PreviewTree::getPath(NodeIndex node) const
+	{
+		std::vector<NodeIndex> ancestorsAndSelf;
+
+		for(; node != rootNode && node != invalidNode; node = nodes[node].parent)
+			ancestorsAndSelf.push_back(node);
+
+		juce::String path;
+
+		for(auto it = ancestorsAndSelf.rbegin(); it != ancestorsAndSelf.rend(); ++it)
+			path << "\\" << names[nodes[*it].name];
+
+		return path;
+	}
+
+	const juce::String& PreviewTree::getName(NodeIndex node) const
+	{
+		return names[nodes[node].name];
+	}
+
+	PreviewTree::NodeIndex PreviewTree::getParent(NodeIndex node) const
+	{
+		return nodes[node].parent;
+	}
+
+	PreviewTree::NodeIndex PreviewTree::getFirstChild(NodeIndex node) const
+	{
+		return nodes[node].firstChild;
+	}
+
+	PreviewTree::NodeIndex PreviewTree::getNextSibling(NodeIndex node) const
+	{
+		return nodes[node].nextSibling;
+	}
+
+	PreviewTree::NodeIndex PreviewTree::getNextDuplicate(NodeIndex node) const
+	{
+		return nodes[node].nextDuplicate;
+	}
+
+	std::size_t PreviewTree::getNumNodes() const
+	{
+		return nodes.size();
+	}
+
+	Import::PreviewItemNode PreviewTree::getItem(NodeIndex node) const
+	{
+		const auto& n = nodes[node];
+		return {names[n.name], n.type, n.objectStatus, n.audioFilePath, n.wavStatus, n.unresolvedWildcard};
+	}
+
+	void PreviewTree::setItem(NodeIndex node, const Import::PreviewItemNode& item)
+	{
+		auto& n = nodes[node];
+		n.type = item.type;
+		n.objectStatus = item.objectStatus;
+		n.audioFilePath = item.audioFilePath;
+		n.wavStatus = item.wavStatus;
+		n.unresolvedWildcard = item.unresolvedWildcard;
+	}
+
+	juce::ValueTree PreviewTree::toValueTree(const juce::Identifier& rootType) const
+	{
+		juce::ValueTree root(rootType);
+
+		struct Entry
+		{
+			NodeIndex node;
+			juce::ValueTree valueTree;
+			juce::String path;
+		};
+
+		std::vector<Entry> stack{{rootNode, root, {}}};
+
+		while(!stack.empty())
+		{
+			auto entry = std::move(stack.back());
+			stack.pop_back();
+
+			for(auto child = nodes[entry.node].firstChild; child != invalidNode; child = nodes[child].nextSibling)
+			{
+				auto path = entry.path + "\\" + names[nodes[child].name];
+				auto childValueTree = ImportHelper::previewItemNodeToValueTree(path, getItem(child));
+
+				entry.valueTree.appendChild(childValueTree, nullptr);
+
+				if(nodes[child].firstChild != invalidNode)
+					stack.push_back({child, childValueTree, path});
+			}
+		}
+
+		return root;
+	}
+
+	void PreviewTree::clear()
+	{
+		// Swapping releases the storage, clear() alone would keep the capacity of the previous preview
+		std::vector<Node>{Node{}}.swap(nodes);
+		std::vector<juce::String>{juce::String()}.swap(names);
+		std::unordered_map<juce::String, NameIndex>{{juce::String(), 0}}.swap(nameIndices);
+		std::unordered_map<std::uint64_t, NodeIndex>().swap(childIndices);
+	}
+
+	std::uint64_t PreviewTree::getChildKey(NodeIndex parent, NameIndex name)
+	{
+		return (static_cast<std::uint64_t>(parent) << 32) | name;
+	}
+
+	PreviewTree::NodeIndex PreviewTree::appendChild(NodeIndex parent, NameIndex name)
+	{
+		const auto child = static_cast<NodeIndex>(nodes.size());
+
+		Node node;
+		node.parent = parent;
+		node.name = name;
+		nodes.push_back(std::move(node));
+
+		auto& parentNode = nodes[parent];
+
+		if(parentNode.lastChild == invalidNode)
+			parentNode.firstChild = child;
+		else
+			nodes[parentNode.lastChild].nextSibling = child;
+
+		parentNode.lastChild = child;
+
+		return child;
+	}
+
+	PreviewTree::NameIndex PreviewTree::findName(const juce::String& name) const
+	{
+		const auto it = nameIndices.find(name);
+		return it != nameIndices.end() ? it->second : static_cast<NameIndex>(names.size());
+	}
+
+	PreviewTree::NameIndex PreviewTree::internName(const juce::String& name)
+	{
+		const auto [it, inserted] = nameIndices.try_emplace(name, static_cast<NameIndex>(names.size()));
+
+		if(inserted)
+			names.push_back(name);
+
+		return it->second;
+	}
+} // namespace AK::WwiseTransfer
@@ -0,0 +1,96 @@
+/*----------------------------------------------------------------------------------------
+
+Copyright (c) 2025 AUDIOKINETIC Inc.
+
+This file is licensed to use under the license available at:
+https://github.com/audiokinetic/ReaWwise/blob/main/License.txt (the "License").
+You may not use this file except in compliance with the License.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations under the License.
+
+----------------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "Model/Import.h"
+
+#include <cstdint>
+#include <juce_core/juce_core.h>
+#include <juce_data_structures/juce_data_structures.h>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace AK::WwiseTransfer
+{
+	// Hierarchy of the objects shown in the import preview, stored in flat arrays indexed by node.
+	// Node names are interned in a pool owned by the tree, so paths are never turned into juce::Identifiers and all memory is released with the tree.
+	class PreviewTree
+	{
+	public:
+		using NodeIndex = std::uint32_t;
+
+		static constexpr NodeIndex rootNode = 0;
+		static constexpr NodeIndex invalidNode = std::numeric_limits<NodeIndex>::max();
+
+		PreviewTree();
+
+		// Returns the child of parent with the given name, adding it if it does not exist yet
+		NodeIndex getOrAddChild(NodeIndex parent, const juce::String& name);
+
+		// Always adds a new child, even if parent already has one with the same name. Lookups by name return the first of them,
+		// the others are reached through getNextDuplicate.
+		NodeIndex addChild(NodeIndex parent, const juce::String& name);
+
+		// Returns the node at the given path without object types (e.g. "\Actor-Mixer Hierarchy\Default Work Unit"), or invalidNode
+		NodeIndex findNode(const juce::String& objectPath) const;
+
+		juce::String getPath(NodeIndex node) const;
+		const juce::String& getName(NodeIndex node) const;
+		NodeIndex getParent(NodeIndex node) const;
+		NodeIndex getFirstChild(NodeIndex node) const;
+		NodeIndex getNextSibling(NodeIndex node) const;
+		NodeIndex getNextDuplicate(NodeIndex node) const;
+		std::size_t getNumNodes() const;
+
+		Import::PreviewItemNode getItem(NodeIndex node) const;
+		void setItem(NodeIndex node, const Import::PreviewItemNode& item);
+
+		// Builds the value tree bound to the preview tree view
+		juce::ValueTree toValueTree(const juce::Identifier& rootType) const;
+
+		void clear();
+
+	private:
+		using NameIndex = std::uint32_t;
+
+		struct Node
+		{
+			NodeIndex parent{invalidNode};
+			NodeIndex firstChild{invalidNode};
+			NodeIndex lastChild{invalidNode};
+			NodeIndex nextSibling{invalidNode};
+			NodeIndex nextDuplicate{invalidNode};
+			NameIndex name{0};
+
+			Wwise::ObjectType type{Wwise::ObjectType::Unknown};
+			Import::ObjectStatus objectStatus{Import::ObjectStatus::New};
+			Import::WavStatus wavStatus{Import::WavStatus::Unknown};
+			bool unresolvedWildcard{false};
+			juce::String audioFilePath;
+		};
+
+		static std::uint64_t getChildKey(NodeIndex parent, NameIndex name);
+		NodeIndex appendChild(NodeIndex parent, NameIndex name);
+		NameIndex findName(const juce::String& name) const;
+		NameIndex internName(const juce::String& name);
+
+		std::vector<Node> nodes;
+		std::vector<juce::String> names;
+		std::unordered_map<juce::String, NameIndex> nameIndices;
+		std::unordered_map<std::uint64_t, NodeIndex> childIndices;
+	};
+} // namespace AK::WwiseTransfer
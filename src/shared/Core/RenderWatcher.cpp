@@ -0,0 +1,185 @@
+/*----------------------------------------------------------------------------------------
+
+Copyright (c) 2025 AUDIOKINETIC Inc.
+
+This file is licensed to use under the license available at:
+https://github.com/audiokinetic/ReaWwise/blob/main/License.txt (the "License").
+You may not use this file except in compliance with the License.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations under the License.
+
+----------------------------------------------------------------------------------------*/
+
+
+#include "RenderWatcher.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+namespace AK::WwiseTransfer
+{
+	namespace RenderWatcherConstants
+	{
+		constexpr int pollIntervalMs = 100;
+		constexpr int stopTimeoutMs = 2000;
+		constexpr int wavHeaderSize = 12;
+	} // namespace RenderWatcherConstants
+
+	RenderWatcher::RenderWatcher(const std::vector<juce::File>& renderTargets, const juce::Time& renderStartTime)
+		: juce::Thread("RenderWatcher")
+		, renderTargets(renderTargets)
+		, modificationTimeThreshold(renderStartTime.toMilliseconds() / 1000 * 1000) // Some file systems only store modification times to the second
+		, pendingTargets(renderTargets.size())
+	{
+		std::iota(pendingTargets.begin(), pendingTargets.end(), 0);
+	}
+
+	RenderWatcher::~RenderWatcher()
+	{
+		signalThreadShouldExit();
+		notify();
+		stopThread(RenderWatcherConstants::stopTimeoutMs);
+	}
+
+	void RenderWatcher::start()
+	{
+		startThread();
+	}
+
+	void RenderWatcher::renderFinished(const std::vector<juce::String>& renderFilePaths)
+	{
+		{
+			std::lock_guard lock(mutex);
+
+			this->renderFilePaths = renderFilePaths;
+			renderIsOver = true;
+		}
+
+		notify();
+	}
+
+	bool RenderWatcher::waitForRenderedTargets(std::vector<std::size_t>& indices, int timeoutMs)
+	{
+		std::unique_lock lock(mutex);
+
+		condition.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this]
+			{
+				return !renderedTargets.empty() || finished;
+			});
+
+		const auto hasRenderedTargets = !renderedTargets.empty();
+
+		indices.insert(indices.end(), renderedTargets.begin(), renderedTargets.end());
+		renderedTargets.clear();
+
+		return hasRenderedTargets || !finished;
+	}
+
+	const juce::File& RenderWatcher::getRenderFile(std::size_t index) const
+	{
+		return renderTargets[index];
+	}
+
+	std::vector<juce::File> RenderWatcher::getFailedTargets() const
+	{
+		std::lock_guard lock(mutex);
+
+		std::vector<juce::File> failedFiles;
+		failedFiles.reserve(failedTargets.size());
+
+		for(const auto index : failedTargets)
+			failedFiles.push_back(renderTargets[index]);
+
+		return failedFiles;
+	}
+
+	bool RenderWatcher::isWavFileComplete(const juce::File& file)
+	{
+		using namespace RenderWatcherConstants;
+
+		// Fails while the file is still opened for writing on some platforms
+		juce::FileInputStream inputStream(file);
+
+		if(inputStream.failedToOpen())
+			return false;
+
+		char header[wavHeaderSize];
+
+		if(inputStream.read(header, wavHeaderSize) != wavHeaderSize)
+			return false;
+
+		if(std::memcmp(header, "RIFF", 4) != 0 || std::memcmp(header + 8, "WAVE", 4) != 0)
+			return false;
+
+		// The RIFF size is written when the file is finalized, it covers everything but the RIFF id and size
+		const auto riffSize = static_cast<juce::int64>(juce::ByteOrder::littleEndianInt(header + 4));
+
+		return riffSize + 8 == inputStream.getTotalLength();
+	}
+
+	void RenderWatcher::run()
+	{
+		while(!threadShouldExit())
+		{
+			bool isRenderOver = false;
+
+			{
+				std::lock_guard lock(mutex);
+				isRenderOver = renderIsOver;
+			}
+
+			checkPendingTargets(isRenderOver);
+
+			if(isRenderOver)
+				break;
+
+			wait(RenderWatcherConstants::pollIntervalMs);
+		}
+
+		std::lock_guard lock(mutex);
+
+		failedTargets = pendingTargets;
+		finished = true;
+
+		condition.notify_all();
+	}
+
+	void RenderWatcher::checkPendingTargets(bool isRenderOver)
+	{
+		std::vector<std::size_t> newlyRenderedTargets;
+
+		auto isRendered = [this, isRenderOver, &newlyRenderedTargets](std::size_t index)
+		{
+			auto& renderTarget = renderTargets[index];
+
+			// Only read once the render is over, renderFilePaths does not change after that
+			if(isRenderOver && index < renderFilePaths.size() && renderFilePaths[index].isNotEmpty())
+				renderTarget = juce::File(renderFilePaths[index]);
+
+			if(renderTarget.getLastModificationTime() < modificationTimeThreshold)
+				return false;
+
+			// Once the render is over, files that are not plain wav files are taken as they are
+			if(!isRenderOver && !isWavFileComplete(renderTarget))
+				return false;
+
+			newlyRenderedTargets.push_back(index);
+			return true;
+		};
+
+		pendingTargets.erase(std::remove_if(pendingTargets.begin(), pendingTargets.end(), isRendered), pendingTargets.end());
+
+		if(newlyRenderedTargets.empty())
+			return;
+
+		std::lock_guard lock(mutex);
+
+		renderedTargets.insert(renderedTargets.end(), newlyRenderedTargets.begin(), newlyRenderedTargets.end());
+
+		condition.notify_all();
+	}
+} // namespace AK::WwiseTransfer
@@ -0,0 +1,72 @@
+/*----------------------------------------------------------------------------------------
+
+Copyright (c) 2025 AUDIOKINETIC Inc.
+
+This file is licensed to use under the license available at:
+https://github.com/audiokinetic/ReaWwise/blob/main/License.txt (the "License").
+You may not use this file except in compliance with the License.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations under the License.
+
+----------------------------------------------------------------------------------------*/
+
+
+#pragma once
+
+#include <condition_variable>
+#include <juce_core/juce_core.h>
+#include <mutex>
+#include <vector>
+
+namespace AK::WwiseTransfer
+{
+	// Watches the render targets while the DAW renders them, so that finished files can be imported before the whole render is over.
+	// Only the pending targets are checked, so the cost depends on the number of targets and not on what else their directories contain.
+	class RenderWatcher
+		: private juce::Thread
+	{
+	public:
+		RenderWatcher(const std::vector<juce::File>& renderTargets, const juce::Time& renderStartTime);
+		~RenderWatcher() override;
+
+		void start();
+
+		// Tells the watcher that the render is over. The render file paths reported by the DAW are in the same order as the render targets
+		// and replace the targets it renamed. Targets that are still pending are checked one last time.
+		void renderFinished(const std::vector<juce::String>& renderFilePaths);
+
+		// Waits for targets to be rendered and appends their indices to the given list.
+		// Returns false once the render is over and every rendered target was reported.
+		bool waitForRenderedTargets(std::vector<std::size_t>& indices, int timeoutMs);
+
+		// The file a reported target was rendered to
+		const juce::File& getRenderFile(std::size_t index) const;
+
+		// The targets that were not rendered, known once waitForRenderedTargets returned false
+		std::vector<juce::File> getFailedTargets() const;
+
+		// Whether the file is a wav file whose header matches its size, which only happens once the writer finalized it
+		static bool isWavFileComplete(const juce::File& file);
+
+	private:
+		void run() override;
+		void checkPendingTargets(bool isRenderOver);
+
+		std::vector<juce::File> renderTargets;
+		const juce::Time modificationTimeThreshold;
+
+		// Only accessed by the watcher thread
+		std::vector<std::size_t> pendingTargets;
+
+		mutable std::mutex mutex;
+		std::condition_variable condition;
+		std::vector<std::size_t> renderedTargets;
+		std::vector<std::size_t> failedTargets;
+		std::vector<juce::String> renderFilePaths;
+		bool renderIsOver{false};
+		bool finished{false};
+	};
+} // namespace AK::WwiseTransfer
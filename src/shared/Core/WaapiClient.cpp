@@ -19,8 +19,11 @@ specific language governing permissions and limitations under the License.
 #include "Model/IDs.h"
 
 #include <JSONHelpers.h>
+#include <cstring>
+#include <future>
 #include <juce_events/juce_events.h>
 #include <set>
+#include <tuple>
 
 namespace
 {
@@ -34,6 +37,63 @@ namespace
 
 		return normalizedPath;
 	}
+
+	// Builds a waql query returning which of the given paths exist in the selection made from the root path
+	juce::String buildExistingPathsWaql(const juce::String& rootPath, const juce::String& selection, const std::vector<juce::String>& paths)
+	{
+		juce::String waql("\"" + rootPath + "\" select " + selection + " where ");
+
+		for(std::size_t i = 0; i < paths.size(); ++i)
+		{
+			if(i > 0)
+				waql << " or ";
+
+			waql << "path = \"" << paths[i] << "\"";
+		}
+
+		return waql;
+	}
+
+	// Builds a waql query selecting the sounds under the root path that use any of the given original wav files
+	juce::String buildSoundsByOriginalWavFilePathsWaql(const juce::String& rootPath, const std::vector<juce::String>& originalWavFilePaths)
+	{
+		juce::String waql("\"" + rootPath + "\" select descendants where type = \"Sound\" and (");
+
+		for(std::size_t i = 0; i < originalWavFilePaths.size(); ++i)
+		{
+			if(i > 0)
+				waql << " or ";
+
+			waql << "sound:originalWavFilePath = \"" << originalWavFilePaths[i] << "\"";
+		}
+
+		return waql << ")";
+	}
+
+	// Builds a regular expression matching any of the object names of the given paths exactly
+	juce::String buildObjectNamesRegex(const std::vector<juce::String>& paths)
+	{
+		static const juce::String specialCharacters("\\^$.|?*+()[]{}");
+
+		juce::StringArray escapedNames;
+
+		for(const auto& path : paths)
+		{
+			juce::String escapedName;
+
+			for(auto character : AK::WwiseTransfer::WwiseHelper::pathToObjectName(path))
+			{
+				if(specialCharacters.containsChar(character))
+					escapedName << "\\";
+
+				escapedName << character;
+			}
+
+			escapedNames.addIfNotAlreadyThere(escapedName);
+		}
+
+		return "^(" + escapedNames.joinIntoString("|") + ")$";
+	}
 }
 
 namespace AK::WwiseTransfer
@@ -45,6 +105,8 @@ namespace AK::WwiseTransfer
 		static constexpr const char* const objectPostDeleted = "ak.wwise.core.object.postDeleted";
 		static constexpr const char* const objectNameChanged = "ak.wwise.core.object.nameChanged";
 		static constexpr const char* const objectCreated = "ak.wwise.core.object.created";
+		static constexpr const char* const objectChildAdded = "ak.wwise.core.object.childAdded";
+		static constexpr const char* const objectChildRemoved = "ak.wwise.core.object.childRemoved";
 		static constexpr const char* const objectGet = "ak.wwise.core.object.get";
 		static constexpr const char* const audioImport = "ak.wwise.core.audio.import";
 		static constexpr const char* const getProjectInfo = "ak.wwise.core.getProjectInfo";
@@ -57,6 +119,12 @@ namespace AK::WwiseTransfer
 		static constexpr const char* const commandsExecute = "ak.wwise.ui.commands.execute";
 	} // namespace WaapiCommands
 
+	namespace WaapiClientConstants
+	{
+		// Keeps each path scoped waql query to a reasonable length
+		constexpr int maxPathsPerQuery = 500;
+	} // namespace WaapiClientConstants
+
 	namespace WaapiURIs
 	{
 		static constexpr const char* const unknownObject = "ak.wwise.query.unknown_object";
@@ -67,6 +135,25 @@ namespace AK::WwiseTransfer
 		static constexpr const char* const objectNotFound = "Object not found";
 	}
 
+	namespace
+	{
+		Waapi::ObjectResponse getEventObject(const WwiseAuthoringAPI::AkJson& json, const char* key)
+		{
+			return json.HasKey(key) ? Waapi::ObjectResponse(json[key]) : Waapi::ObjectResponse();
+		}
+
+		juce::String getEventParentId(const WwiseAuthoringAPI::AkJson& json)
+		{
+			if(json.HasKey("object") && json["object"].HasKey("parent") && json["object"]["parent"].HasKey("id"))
+				return json["object"]["parent"]["id"].GetVariant().GetString();
+
+			if(json.HasKey("parent") && json["parent"].HasKey("id"))
+				return json["parent"]["id"].GetVariant().GetString();
+
+			return {};
+		}
+	} // namespace
+
 	WaapiClientWatcher::WaapiClientWatcher(juce::ValueTree appState, WaapiClient& waapiClient, WaapiClientWatcherConfig&& waapiClientWatcherConfig)
 		: juce::Thread("WaapiService")
 		, applicationState(appState)
@@ -117,6 +204,8 @@ namespace AK::WwiseTransfer
 		{
 			juce::Logger::writeToLog("Received project loaded event");
 
+			waapiClient.getObjectCache().clear();
+
 			setProjectId("");
 		};
 
@@ -124,16 +213,69 @@ namespace AK::WwiseTransfer
 		{
 			juce::Logger::writeToLog("Received project post close event");
 
+			waapiClient.getObjectCache().clear();
+
 			applicationState.setProperty(IDs::projectPath, "", nullptr);
 		};
 
-		auto onObjectEvent = [this](auto, auto)
+		// Object events patch the object cache in place so that the refresh triggered by wwiseObjectsChanged is answered from memory
+		auto onObjectCreated = [this](auto, const AkJson& json)
+		{
+			juce::Logger::writeToLog("Received object created event");
+
+			waapiClient.getObjectCache().onObjectCreated(getEventObject(json, "object"), getEventParentId(json));
+			setWwiseObjectsChanged(true);
+		};
+
+		auto onObjectPostDeleted = [this](auto, const AkJson& json)
 		{
-			juce::Logger::writeToLog("Received object related event");
+			juce::Logger::writeToLog("Received object postDeleted event");
 
+			waapiClient.getObjectCache().onObjectDeleted(getEventObject(json, "object"));
 			setWwiseObjectsChanged(true);
 		};
 
+		auto onObjectNameChanged = [this](auto, const AkJson& json)
+		{
+			juce::Logger::writeToLog("Received object nameChanged event");
+
+			const juce::String oldName = json.HasKey("oldName") ? json["oldName"].GetVariant().GetString() : "";
+
+			waapiClient.getObjectCache().onObjectRenamed(getEventObject(json, "object"), oldName);
+			setWwiseObjectsChanged(true);
+		};
+
+		auto onObjectChildAdded = [this](auto, const AkJson& json)
+		{
+			juce::Logger::writeToLog("Received object childAdded event");
+
+			waapiClient.getObjectCache().onChildAdded(getEventObject(json, "child"));
+			setWwiseObjectsChanged(true);
+		};
+
+		auto onObjectChildRemoved = [this](auto, const AkJson& json)
+		{
+			juce::Logger::writeToLog("Received object childRemoved event");
+
+			waapiClient.getObjectCache().onChildRemoved(getEventObject(json, "child"));
+			setWwiseObjectsChanged(true);
+		};
+
+		static const auto objectEventOptions = AkJson::Map{
+			{
+				"return",
+				AkJson::Array{
+					AkVariant{"id"},
+					AkVariant{"name"},
+					AkVariant{"type"},
+					AkVariant{"path"},
+					AkVariant{"parent"},
+					AkVariant{"sound:originalWavFilePath"},
+					AkVariant{"workunitType"},
+				},
+			},
+		};
+
 		while(!threadShouldExit())
 		{
 			{
@@ -177,7 +319,7 @@ namespace AK::WwiseTransfer
 						juce::Logger::writeToLog("Failed to subscribed to project post closed");
 					}
 
-					if(waapiClient.subscribe(WaapiCommands::objectCreated, AkJson::Map{}, onObjectEvent, objectCreatedEventSubscriptionId, subscribeResult))
+					if(waapiClient.subscribe(WaapiCommands::objectCreated, objectEventOptions, onObjectCreated, objectCreatedEventSubscriptionId, subscribeResult))
 					{
 						juce::Logger::writeToLog("Subscribed to object created");
 					}
@@ -186,7 +328,7 @@ namespace AK::WwiseTransfer
 						juce::Logger::writeToLog("Failed to subscribed to object created");
 					}
 
-					if(waapiClient.subscribe(WaapiCommands::objectPostDeleted, AkJson::Map{}, onObjectEvent, objectPostDeletedEventSubscriptionId, subscribeResult))
+					if(waapiClient.subscribe(WaapiCommands::objectPostDeleted, objectEventOptions, onObjectPostDeleted, objectPostDeletedEventSubscriptionId, subscribeResult))
 					{
 						juce::Logger::writeToLog("Subscribed to object postDeleted");
 					}
@@ -195,7 +337,7 @@ namespace AK::WwiseTransfer
 						juce::Logger::writeToLog("Failed to subscribed to object postDeleted");
 					}
 
-					if(waapiClient.subscribe(WaapiCommands::objectNameChanged, AkJson::Map{}, onObjectEvent, objectNameChangedEventSubscriptionId, subscribeResult))
+					if(waapiClient.subscribe(WaapiCommands::objectNameChanged, objectEventOptions, onObjectNameChanged, objectNameChangedEventSubscriptionId, subscribeResult))
 					{
 						juce::Logger::writeToLog("Subscribed to object nameChanged");
 					}
@@ -204,6 +346,25 @@ namespace AK::WwiseTransfer
 						juce::Logger::writeToLog("Failed to subscribed to object nameChanged");
 					}
 
+					// Moving objects is only reported through these events
+					if(waapiClient.subscribe(WaapiCommands::objectChildAdded, objectEventOptions, onObjectChildAdded, objectChildAddedEventSubscriptionId, subscribeResult))
+					{
+						juce::Logger::writeToLog("Subscribed to object childAdded");
+					}
+					else
+					{
+						juce::Logger::writeToLog("Failed to subscribed to object childAdded");
+					}
+
+					if(waapiClient.subscribe(WaapiCommands::objectChildRemoved, objectEventOptions, onObjectChildRemoved, objectChildRemovedEventSubscriptionId, subscribeResult))
+					{
+						juce::Logger::writeToLog("Subscribed to object childRemoved");
+					}
+					else
+					{
+						juce::Logger::writeToLog("Failed to subscribed to object childRemoved");
+					}
+
 					setWaapiConnected(true);
 				}
 				else
@@ -303,6 +464,24 @@ namespace AK::WwiseTransfer
 			juce::Logger::writeToLog("Failed to unsubscribed from object postDeleted");
 		}
 
+		if(waapiClient.unsubscribe(objectChildAddedEventSubscriptionId, result))
+		{
+			juce::Logger::writeToLog("Unsubscribed from object childAdded");
+		}
+		else
+		{
+			juce::Logger::writeToLog("Failed to unsubscribed from object childAdded");
+		}
+
+		if(waapiClient.unsubscribe(objectChildRemovedEventSubscriptionId, result))
+		{
+			juce::Logger::writeToLog("Unsubscribed from object childRemoved");
+		}
+		else
+		{
+			juce::Logger::writeToLog("Failed to unsubscribed from object childRemoved");
+		}
+
 		waapiClient.disconnect();
 
 		setWaapiConnected(false);
@@ -327,6 +506,9 @@ namespace AK::WwiseTransfer
 
 	bool WaapiClient::connect(const char* in_uri, unsigned int in_port, WwiseAuthoringAPI::disconnectHandler_t disconnectHandler, int in_timeoutMs)
 	{
+		// Events may have been missed while disconnected
+		objectCache.clear();
+
 		return Connect(in_uri, in_port, disconnectHandler, in_timeoutMs);
 	}
 
@@ -348,90 +530,113 @@ namespace AK::WwiseTransfer
 	void WaapiClient::disconnect()
 	{
 		Disconnect();
+
+		objectCache.clear();
 	}
 
 	bool WaapiClient::call(const char* in_uri, const WwiseAuthoringAPI::AkJson& in_args, const WwiseAuthoringAPI::AkJson& in_options, WwiseAuthoringAPI::AkJson& out_result, int in_timeoutMs)
 	{
 		using namespace WwiseAuthoringAPI;
 
-		auto status = Call(in_uri, in_args, in_options, out_result, in_timeoutMs);
+		const auto startTimeMs = juce::Time::getMillisecondCounterHiRes();
+
+		auto status = Call(in_uri, in_args, in_options, out_result, WaapiHelper::getCallTimeoutMs(in_timeoutMs));
 
-		juce::Logger::writeToLog(juce::String(in_uri) +
-								 juce::NewLine() + juce::String("args: ") + JSONHelpers::GetAkJsonString(in_args).substr(0, 10'000) + // Cap the args strings logged to 10,000 characters to avoid crashing the JUCE logger.
-								 juce::NewLine() + juce::String("options: ") + JSONHelpers::GetAkJsonString(in_options) +
-								 juce::NewLine() + juce::String("result: ") + JSONHelpers::GetAkJsonString(out_result));
+		WaapiMetrics::getInstance().recordCall(in_uri, status, juce::Time::getMillisecondCounterHiRes() - startTimeMs,
+			WaapiHelper::estimateJsonSize(in_args).bytes, WaapiHelper::estimateJsonSize(out_result).bytes);
+
+		logCall(in_uri, status, startTimeMs, [&in_args, &in_options, &out_result]()
+			{
+				return juce::NewLine() + juce::String("args: ") + WaapiHelper::toLogString(in_args) +
+				       juce::NewLine() + juce::String("options: ") + WaapiHelper::toLogString(in_options) +
+				       juce::NewLine() + juce::String("result: ") + WaapiHelper::toLogString(out_result);
+			});
 
 		return status;
 	}
 
 	bool WaapiClient::call(const char* in_uri, const char* in_args, const char* in_options, std::string& out_result, int in_timeoutMs)
 	{
-		auto status = Call(in_uri, in_args, in_options, out_result, in_timeoutMs);
+		const auto startTimeMs = juce::Time::getMillisecondCounterHiRes();
+
+		auto status = Call(in_uri, in_args, in_options, out_result, WaapiHelper::getCallTimeoutMs(in_timeoutMs));
+
+		WaapiMetrics::getInstance().recordCall(in_uri, status, juce::Time::getMillisecondCounterHiRes() - startTimeMs,
+			std::strlen(in_args), out_result.size());
 
-		juce::Logger::writeToLog(juce::String(in_uri) +
-								 juce::NewLine() + juce::String("args: ") + in_args +
-								 juce::NewLine() + juce::String("options: ") + in_options +
-								 juce::NewLine() + juce::String("result: ") + out_result);
+		logCall(in_uri, status, startTimeMs, [in_args, in_options, &out_result]()
+			{
+				return juce::NewLine() + juce::String("args: ") + WaapiHelper::toLogString(std::string_view(in_args)) +
+				       juce::NewLine() + juce::String("options: ") + WaapiHelper::toLogString(std::string_view(in_options)) +
+				       juce::NewLine() + juce::String("result: ") + WaapiHelper::toLogString(std::string_view(out_result));
+			});
 
 		return status;
 	}
 
+	void WaapiClient::setLogLevel(Waapi::LogLevel level)
+	{
+		logLevel = level;
+	}
+
+	void WaapiClient::logCall(const char* uri, bool status, double startTimeMs, const std::function<juce::String()>& getDetails)
+	{
+		const auto level = logLevel.load();
+
+		if(level == Waapi::LogLevel::Off)
+			return;
+
+		const auto elapsedMs = juce::Time::getMillisecondCounterHiRes() - startTimeMs;
+
+		juce::String message(uri);
+		message << (status ? " succeeded" : " failed") << " in " << juce::String(elapsedMs, 1) << " ms";
+
+		// Payloads are only serialized when they are actually logged
+		if(level == Waapi::LogLevel::Debug)
+			message << getDetails();
+
+		juce::Logger::writeToLog(message);
+	}
+
 	Waapi::Response<Waapi::ObjectResponseSet> WaapiClient::import(const std::vector<Waapi::ImportItemRequest>& importItemsRequest, Import::ContainerNameExistsOption containerNameExistsOption, const juce::String& objectLanguage)
 	{
 		using namespace WwiseAuthoringAPI;
 
 		Waapi::Response<Waapi::ObjectResponseSet> response;
 
-		AkJson::Array importItemsAsJson;
+		// The arguments are built in place so that the base64 payloads are not copied again on their way into the call
+		AkJson args(AkJson::Map{});
+		auto& argsMap = args.GetMap();
+
+		argsMap.emplace("importOperation", AkVariant(ImportHelper::containerNameExistsOptionToString(containerNameExistsOption).toStdString()));
+		argsMap.emplace("default", AkJson::Map{{"importLanguage", AkVariant(objectLanguage.toStdString())}});
+		argsMap.emplace("autoAddToSourceControl", AkVariant(true));
+
+		auto& importItemsAsJson = argsMap.emplace("imports", AkJson(AkJson::Array{})).first->second.GetArray();
+		importItemsAsJson.reserve(importItemsRequest.size());
+
 		for(const auto& importItemRequest : importItemsRequest)
 		{
-			std::string key;
-			std::string value;
-			if(importItemRequest.renderFileWavBase64.isEmpty())
+			auto& importItemAsJson = importItemsAsJson.emplace_back(AkJson::Map{}).GetMap();
+
+			if(importItemRequest.renderFileWavBase64.empty())
 			{
-				key = "audioFile";
-				value = importItemRequest.renderFilePath.toStdString();
+				importItemAsJson.emplace("audioFile", AkVariant(importItemRequest.renderFilePath.toStdString()));
 			}
 			else
 			{
-				key = "audioFileBase64";
-				value = importItemRequest.renderFileName.toStdString() + "|" + importItemRequest.renderFileWavBase64.toStdString();
-			}
-			using namespace juce;
-			auto importItemAsJson = AkJson(AkJson::Map{
-				{key,
-					AkVariant(value)},
-				{
-					"objectPath",
-					AkVariant(importItemRequest.path.toStdString()),
-				},
-				{
-					"originalsSubFolder",
-					AkVariant(importItemRequest.originalsSubFolder.toStdString()),
-				},
-			});
+				const auto renderFileName = importItemRequest.renderFileName.toStdString();
 
-			importItemsAsJson.push_back(importItemAsJson);
-		};
+				std::string value;
+				value.reserve(renderFileName.size() + 1 + importItemRequest.renderFileWavBase64.size());
+				value.append(renderFileName).append("|").append(importItemRequest.renderFileWavBase64);
 
-		const auto args = AkJson::Map{
-			{
-				"importOperation",
-				AkVariant(ImportHelper::containerNameExistsOptionToString(containerNameExistsOption).toStdString()),
-			},
-			{
-				"default",
-				AkJson::Map{{"importLanguage", AkVariant(objectLanguage.toStdString())}},
-			},
-			{
-				"imports",
-				importItemsAsJson,
-			},
-			{
-				"autoAddToSourceControl",
-				AkVariant(true),
-			},
-		};
+				importItemAsJson.emplace("audioFileBase64", AkVariant(std::move(value)));
+			}
+
+			importItemAsJson.emplace("objectPath", AkVariant(importItemRequest.path.toStdString()));
+			importItemAsJson.emplace("originalsSubFolder", AkVariant(importItemRequest.originalsSubFolder.toStdString()));
+		}
 
 		static const auto options = AkJson::Map{
 			{
@@ -460,6 +665,8 @@ namespace AK::WwiseTransfer
 					response.result.emplace(object);
 				}
 			}
+
+			objectCache.onObjectsImported(response.result);
 		}
 		else
 		{
@@ -494,7 +701,27 @@ namespace AK::WwiseTransfer
 		return call(WaapiCommands::commandsExecute, args, AkJson::Map{}, result);
 	}
 
+	WaapiObjectCache& WaapiClient::getObjectCache()
+	{
+		return objectCache;
+	}
+
 	Waapi::Response<Waapi::ObjectResponseSet> WaapiClient::getObjectAncestorsAndDescendants(const juce::String& objectPath)
+	{
+		if(auto objects = objectCache.getObjectAncestorsAndDescendants(objectPath))
+			return {true, std::move(*objects), {}};
+
+		const auto revision = objectCache.getRevision();
+
+		auto response = fetchObjectAncestorsAndDescendants(objectPath);
+
+		if(response.status)
+			objectCache.addObjectAncestorsAndDescendants(objectPath, response.result, revision);
+
+		return response;
+	}
+
+	Waapi::Response<Waapi::ObjectResponseSet> WaapiClient::fetchObjectAncestorsAndDescendants(const juce::String& objectPath)
 	{
 		using namespace WwiseAuthoringAPI;
 
@@ -529,24 +756,19 @@ namespace AK::WwiseTransfer
 		if(!response.status)
 		{
 			// The waql query above will fail if the object was not found.
-			// We still want to know if ancestors exist.
-			auto objectAncestors = WwiseHelper::pathToAncestorPaths(objectPath);
+			// We still want to know if ancestors exist. Ask for all of them at once, starting from the top level ancestor.
+			const auto objectAncestors = WwiseHelper::pathToAncestorPaths(objectPath);
 
-			for(int i = objectAncestors.size() - 1; i >= 0; --i)
+			if(!objectAncestors.empty())
 			{
-				auto waql = juce::String("\"" + objectAncestors[i] + "\" select this, ancestors");
-
 				const auto args = AkJson::Map{
 					{
 						"waql",
-						AkVariant{waql.toStdString()},
+						AkVariant{buildExistingPathsWaql(objectAncestors.front(), "this, descendants", objectAncestors).toStdString()},
 					},
 				};
 
 				response.status = call(WaapiCommands::objectGet, args, options, result);
-
-				if(response.status)
-					break;
 			}
 		}
 
@@ -577,6 +799,155 @@ namespace AK::WwiseTransfer
 		return response;
 	}
 
+	Waapi::Response<Waapi::ObjectResponseSet> WaapiClient::getSoundsByOriginalWavFilePaths(const juce::String& rootPath, const std::vector<juce::String>& originalWavFilePaths)
+	{
+		using namespace WwiseAuthoringAPI;
+
+		Waapi::Response<Waapi::ObjectResponseSet> response{true, {}, {}};
+
+		static const auto options = AkJson::Map{
+			{
+				"return",
+				AkJson::Array{
+					AkVariant{"id"},
+					AkVariant{"name"},
+					AkVariant{"type"},
+					AkVariant{"path"},
+					AkVariant{"sound:originalWavFilePath"},
+				},
+			},
+		};
+
+		for(std::size_t begin = 0; begin < originalWavFilePaths.size(); begin += WaapiClientConstants::maxPathsPerQuery)
+		{
+			const auto end = std::min(originalWavFilePaths.size(), begin + WaapiClientConstants::maxPathsPerQuery);
+			const std::vector<juce::String> chunk(originalWavFilePaths.begin() + begin, originalWavFilePaths.begin() + end);
+
+			const auto args = AkJson::Map{
+				{
+					"waql",
+					AkVariant{buildSoundsByOriginalWavFilePathsWaql(rootPath, chunk).toStdString()},
+				},
+			};
+
+			AkJson result;
+
+			if(!call(WaapiCommands::objectGet, args, options, result))
+			{
+				// Nothing was imported under a root path that doesn't exist yet
+				if(result.HasKey("message") && juce::String(result["message"].GetVariant().GetString()).contains(WaapiMessages::objectNotFound))
+					return {true, {}, {}};
+
+				return {false, {}, WaapiHelper::parseError(WaapiCommands::objectGet, result)};
+			}
+
+			if(result.HasKey("return"))
+			{
+				for(auto& object : result["return"].GetArray())
+					response.result.emplace(object);
+			}
+		}
+
+		return response;
+	}
+
+	Waapi::Response<Waapi::ObjectResponseSet> WaapiClient::getObjectsByPaths(const juce::String& rootPath, const std::set<juce::String>& objectPaths)
+	{
+		// Ancestors are always part of the query so that the cache can keep the objects up to date
+		std::set<juce::String> paths{rootPath};
+
+		for(const auto& objectPath : objectPaths)
+			paths.insert(objectPath);
+
+		for(const auto& objectPath : std::set<juce::String>(paths))
+		{
+			for(const auto& ancestorPath : WwiseHelper::pathToAncestorPaths(objectPath))
+				paths.insert(ancestorPath);
+		}
+
+		if(auto objects = objectCache.getObjects(paths))
+			return {true, std::move(*objects), {}};
+
+		const auto revision = objectCache.getRevision();
+
+		auto response = fetchObjectsByPaths(rootPath, paths);
+
+		if(response.status)
+			objectCache.addObjects(paths, response.result, revision);
+
+		return response;
+	}
+
+	Waapi::Response<Waapi::ObjectResponseSet> WaapiClient::fetchObjectsByPaths(const juce::String& rootPath, const std::set<juce::String>& objectPaths)
+	{
+		using namespace WwiseAuthoringAPI;
+
+		Waapi::Response<Waapi::ObjectResponseSet> response;
+
+		static const auto options = AkJson::Map{
+			{
+				"return",
+				AkJson::Array{
+					AkVariant{"id"},
+					AkVariant{"name"},
+					AkVariant{"type"},
+					AkVariant{"path"},
+					AkVariant{"sound:originalWavFilePath"},
+					AkVariant{"workunitType"},
+				},
+			},
+		};
+
+		const std::vector<juce::String> paths(objectPaths.begin(), objectPaths.end());
+
+		for(std::size_t begin = 0; begin < paths.size(); begin += WaapiClientConstants::maxPathsPerQuery)
+		{
+			const auto end = std::min(paths.size(), begin + WaapiClientConstants::maxPathsPerQuery);
+			const std::vector<juce::String> chunk(paths.begin() + begin, paths.begin() + end);
+
+			const auto args = AkJson::Map{
+				{
+					"waql",
+					AkVariant{buildExistingPathsWaql(rootPath, "this, ancestors, descendants", chunk).toStdString()},
+				},
+			};
+
+			AkJson result;
+			response.status = call(WaapiCommands::objectGet, args, options, result);
+
+			if(!response.status)
+			{
+				// The root path may not exist yet, in which case the query fails. The whole subtree query handles that case.
+				auto subtreeResponse = fetchObjectAncestorsAndDescendants(rootPath);
+
+				if(subtreeResponse.status)
+				{
+					response.result.clear();
+
+					for(const auto& object : subtreeResponse.result)
+					{
+						if(objectPaths.count(object.path) > 0)
+							response.result.insert(object);
+					}
+				}
+
+				return {subtreeResponse.status, std::move(response.result), subtreeResponse.error};
+			}
+
+			if(result.HasKey("return"))
+			{
+				auto objects = result["return"].GetArray();
+
+				for(auto& object : objects)
+				{
+					response.result.emplace(object);
+				}
+			}
+		}
+
+		return response;
+	}
+
 	Waapi::Response<std::vector<juce::String>> WaapiClient::getProjectLanguages()
 	{
 		using namespace WwiseAuthoringAPI;
@@ -640,6 +1011,21 @@ namespace AK::WwiseTransfer
 	}
 
 	Waapi::Response<Waapi::ObjectResponseSet> WaapiClient::getObjectAncestorsAndDescendantsLegacy(const juce::String& objectPath)
+	{
+		if(auto objects = objectCache.getObjectAncestorsAndDescendants(objectPath))
+			return {true, std::move(*objects), {}};
+
+		const auto revision = objectCache.getRevision();
+
+		auto response = fetchObjectAncestorsAndDescendantsLegacy(objectPath);
+
+		if(response.status)
+			objectCache.addObjectAncestorsAndDescendants(objectPath, response.result, revision);
+
+		return response;
+	}
+
+	Waapi::Response<Waapi::ObjectResponseSet> WaapiClient::fetchObjectAncestorsAndDescendantsLegacy(const juce::String& objectPath)
 	{
 		using namespace WwiseAuthoringAPI;
 
@@ -705,26 +1091,40 @@ namespace AK::WwiseTransfer
 			},
 		};
 
-		auto args = buildArgs(objectPath);
+		// The queries are independent of each other. Sending them at once makes them cost a single round trip.
+		auto callAsync = [this](AkJson::Map args)
+		{
+			return std::async(std::launch::async, [this, args = std::move(args), callDeadlineMs = WaapiHelper::callDeadlineMs]()
+				{
+					const WaapiHelper::ScopedCallDeadline scopedCallDeadline(callDeadlineMs);
 
-		AkJson result;
-		response.status = call(WaapiCommands::objectGet, args, options, result);
+					std::pair<bool, AkJson> statusAndResult;
+					statusAndResult.first = call(WaapiCommands::objectGet, args, options, statusAndResult.second);
 
-		if(response.status)
-			fillResponse(response, result);
+					return statusAndResult;
+				});
+		};
 
-		args = buildArgs(objectPath);
-		addTransform(args, "descendants");
+		auto descendantsArgs = buildArgs(objectPath);
+		addTransform(descendantsArgs, "descendants");
 
-		response.status = call(WaapiCommands::objectGet, args, options, result);
+		auto ancestorsArgs = buildArgs(objectPath);
+		addTransform(ancestorsArgs, "ancestors");
 
-		if(response.status)
-			fillResponse(response, result);
+		auto objectQuery = callAsync(buildArgs(objectPath));
+		auto descendantsQuery = callAsync(std::move(descendantsArgs));
+		auto ancestorsQuery = callAsync(std::move(ancestorsArgs));
 
-		args = buildArgs(objectPath);
-		addTransform(args, "ancestors");
+		for(auto* query : {&objectQuery, &descendantsQuery})
+		{
+			auto [status, queryResult] = query->get();
 
-		response.status = call(WaapiCommands::objectGet, args, options, result);
+			if(status)
+				fillResponse(response, queryResult);
+		}
+
+		AkJson result;
+		std::tie(response.status, result) = ancestorsQuery.get();
 
 		if(response.status)
 			fillResponse(response, result);
@@ -732,25 +1132,88 @@ namespace AK::WwiseTransfer
 		{
 			auto objectAncestors = WwiseHelper::pathToAncestorPaths(objectPath);
 
-			for(int i = objectAncestors.size() - 1; i >= 0; --i)
+			// Look for the remaining ancestors in a single query by filtering the descendants of the top level ancestor by name
+			std::future<std::pair<bool, AkJson>> candidatesQuery;
+			std::vector<juce::String> candidatePaths;
+
+			if(objectAncestors.size() > 1)
 			{
-				args = buildArgs(objectAncestors[i]);
+				candidatePaths.assign(objectAncestors.begin() + 1, objectAncestors.end());
 
-				response.status = call(WaapiCommands::objectGet, args, options, result);
+				auto args = buildArgs(objectAncestors.front());
+				args["transform"] = AkJson::Array{
+					AkJson::Map{
+						{
+							"select",
+							AkJson::Array{
+								AkVariant{"descendants"},
+							},
+						},
+					},
+					AkJson::Map{
+						{
+							"where",
+							AkJson::Array{
+								AkVariant{"name:matches"},
+								AkVariant{buildObjectNamesRegex(candidatePaths).toStdString()},
+							},
+						},
+					},
+				};
+
+				candidatesQuery = callAsync(std::move(args));
+			}
+
+			// The top level ancestor is needed in any case, if it does not exist none of the other ancestors do
+			if(!objectAncestors.empty())
+			{
+				response.status = call(WaapiCommands::objectGet, buildArgs(objectAncestors.front()), options, result);
 
 				if(response.status)
-				{
 					fillResponse(response, result);
+			}
 
-					args = buildArgs(objectAncestors[i]);
-					addTransform(args, "ancestors");
+			if(candidatesQuery.valid())
+			{
+				auto [candidatesStatus, candidatesResult] = candidatesQuery.get();
+
+				// Nothing to look for under a top level ancestor that does not exist
+				if(response.status && candidatesStatus)
+				{
+					if(candidatesResult.HasKey("return"))
+					{
+						const std::set<juce::String> candidatePathSet(candidatePaths.begin(), candidatePaths.end());
 
-					response.status = call(WaapiCommands::objectGet, args, options, result);
+						// Names can match in other branches, only keep the actual ancestors
+						for(auto& object : candidatesResult["return"].GetArray())
+						{
+							Waapi::ObjectResponse objectResponse(object);
 
-					if(response.status)
+							if(candidatePathSet.count(objectResponse.path) > 0)
+								response.result.emplace(std::move(objectResponse));
+						}
+					}
+				}
+				else if(response.status)
+				{
+					// Versions that can't filter by name: walk up the ancestors one level at a time
+					for(int i = static_cast<int>(objectAncestors.size()) - 1; i > 0; --i)
 					{
-						fillResponse(response, result);
-						break;
+						auto args = buildArgs(objectAncestors[i]);
+
+						AkJson ancestorResult;
+						if(call(WaapiCommands::objectGet, args, options, ancestorResult))
+						{
+							fillResponse(response, ancestorResult);
+
+							args = buildArgs(objectAncestors[i]);
+							addTransform(args, "ancestors");
+
+							if(call(WaapiCommands::objectGet, args, options, ancestorResult))
+								fillResponse(response, ancestorResult);
+
+							break;
+						}
 					}
 				}
 			}
@@ -763,6 +1226,14 @@ namespace AK::WwiseTransfer
 	}
 
 	Waapi::Response<Waapi::ObjectResponse> WaapiClient::getObject(const juce::String& objectPath)
+	{
+		if(auto object = objectCache.getObject(objectPath))
+			return {true, std::move(*object), {}};
+
+		return fetchObject(objectPath);
+	}
+
+	Waapi::Response<Waapi::ObjectResponse> WaapiClient::fetchObject(const juce::String& objectPath)
 	{
 		using namespace WwiseAuthoringAPI;
 
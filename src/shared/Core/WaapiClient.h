@@ -21,9 +21,14 @@ specific language governing permissions and limitations under the License.
 #include "Model/Import.h"
 #include "Model/Waapi.h"
 #include "Model/Wwise.h"
+#include "WaapiMetrics.h"
+#include "WaapiObjectCache.h"
 
+#include <atomic>
+#include <functional>
 #include <juce_core/juce_core.h>
 #include <juce_events/juce_events.h>
+#include <memory>
 
 namespace AK::WwiseTransfer
 {
@@ -41,9 +46,11 @@ namespace AK::WwiseTransfer
 		: public juce::ThreadPoolJob
 	{
 	public:
-		AsyncJob(const Function& function, const Callback& callback)
+		AsyncJob(const Function& function, const Callback& callback, std::shared_ptr<WaapiHelper::CancellationToken> cancellationToken = nullptr, const WaapiHelper::RetryPolicy& retryPolicy = {})
 			: function(function)
 			, callback(callback)
+			, cancellationToken(std::move(cancellationToken))
+			, retryPolicy(retryPolicy)
 			, juce::ThreadPoolJob("AsyncJob")
 		{
 		}
@@ -51,15 +58,39 @@ namespace AK::WwiseTransfer
 		juce::ThreadPoolJob::JobStatus runJob() override
 		{
 			decltype(function()) response;
+			int attempt = 0;
 
-			auto onExecute = [this, &response]()
+			auto isCancelled = [this]()
 			{
+				return cancellationToken != nullptr && cancellationToken->isCancelled();
+			};
+
+			auto shouldStop = [this, &isCancelled]()
+			{
+				return shouldExit() || isCancelled();
+			};
+
+			// Jobs may have been cancelled while waiting in the pool
+			if(isCancelled())
+				return juce::ThreadPoolJob::JobStatus::jobHasFinished;
+
+			auto onExecute = [this, &response, &attempt]()
+			{
+				const WaapiMetrics::ScopedRetry scopedRetry(attempt++ > 0);
+
 				response = function();
 
-				return response.status || shouldExit();
+				if(response.status)
+					return WaapiHelper::AttemptStatus::Succeeded;
+
+				return WaapiHelper::isTransientError(response.error) ? WaapiHelper::AttemptStatus::TransientFailure : WaapiHelper::AttemptStatus::PermanentFailure;
 			};
 
-			WaapiHelper::executeWithRetry(onExecute);
+			WaapiHelper::executeWithRetry(onExecute, retryPolicy, shouldStop);
+
+			// Nobody is waiting for the result of a cancelled job
+			if(isCancelled())
+				return juce::ThreadPoolJob::JobStatus::jobHasFinished;
 
 			auto onJobComplete = [callback = callback, response = std::move(response)]
 			{
@@ -74,6 +105,8 @@ namespace AK::WwiseTransfer
 	private:
 		Callback callback;
 		Function function;
+		std::shared_ptr<WaapiHelper::CancellationToken> cancellationToken;
+		WaapiHelper::RetryPolicy retryPolicy;
 	};
 
 	class WaapiClient
@@ -98,11 +131,21 @@ namespace AK::WwiseTransfer
 		Waapi::Response<Waapi::ObjectResponseSet> import(const std::vector<Waapi::ImportItemRequest>& importItemsRequest, Import::ContainerNameExistsOption containerNameExistsOption, const juce::String& objectLanguage);
 		Waapi::Response<Waapi::ObjectResponseSet> getObjectAncestorsAndDescendants(const juce::String& objectPath);
 		Waapi::Response<Waapi::ObjectResponseSet> getObjectAncestorsAndDescendantsLegacy(const juce::String& objectPath);
+
+		// Returns the existing objects among the paths and their ancestors. The paths must be the root path, its ancestors or its descendants.
+		Waapi::Response<Waapi::ObjectResponseSet> getObjectsByPaths(const juce::String& rootPath, const std::set<juce::String>& objectPaths);
+
+		// Returns the sounds under the root path that use any of the given original wav files
+		Waapi::Response<Waapi::ObjectResponseSet> getSoundsByOriginalWavFilePaths(const juce::String& rootPath, const std::vector<juce::String>& originalWavFilePaths);
 		Waapi::Response<std::vector<juce::String>> getProjectLanguages();
 		Waapi::Response<Waapi::ObjectResponse> getObject(const juce::String& objectPath);
 
 		bool selectObjects(const juce::String& selectObjectsCommand, const std::vector<juce::String>& objectPaths);
 
+		WaapiObjectCache& getObjectCache();
+
+		void setLogLevel(Waapi::LogLevel level);
+
 		void beginUndoGroup();
 		void cancelUndoGroup();
 		void endUndoGroup(const juce::String& displayName);
@@ -115,7 +158,7 @@ namespace AK::WwiseTransfer
 				return getVersion();
 			};
 
-			threadPool.addJob(new AsyncJob(onJobExecute, callback), true);
+			threadPool.addJob(new AsyncJob(onJobExecute, callback, nullptr, WaapiHelper::createRetryPolicy(WaapiHelper::WaapiHelperConstants::lightCallDeadlineMs)), true);
 		}
 
 		template <typename Callback>
@@ -126,7 +169,7 @@ namespace AK::WwiseTransfer
 				return getProjectInfo();
 			};
 
-			threadPool.addJob(new AsyncJob(onJobExecute, callback), true);
+			threadPool.addJob(new AsyncJob(onJobExecute, callback, nullptr, WaapiHelper::createRetryPolicy(WaapiHelper::WaapiHelperConstants::lightCallDeadlineMs)), true);
 		}
 
 		template <typename Callback>
@@ -137,7 +180,7 @@ namespace AK::WwiseTransfer
 				return getAdditionalProjectInfo();
 			};
 
-			threadPool.addJob(new AsyncJob(onJobExecute, callback), true);
+			threadPool.addJob(new AsyncJob(onJobExecute, callback, nullptr, WaapiHelper::createRetryPolicy(WaapiHelper::WaapiHelperConstants::lightCallDeadlineMs)), true);
 		}
 
 		template <typename Callback>
@@ -148,7 +191,7 @@ namespace AK::WwiseTransfer
 				return getSelectedObject();
 			};
 
-			threadPool.addJob(new AsyncJob(onJobExecute, callback), true);
+			threadPool.addJob(new AsyncJob(onJobExecute, callback, nullptr, WaapiHelper::createRetryPolicy(WaapiHelper::WaapiHelperConstants::lightCallDeadlineMs)), true);
 		}
 
 		template <typename Callback>
@@ -170,7 +213,7 @@ namespace AK::WwiseTransfer
 				return getProjectLanguages();
 			};
 
-			threadPool.addJob(new AsyncJob(onJobExecute, callback), true);
+			threadPool.addJob(new AsyncJob(onJobExecute, callback, nullptr, WaapiHelper::createRetryPolicy(WaapiHelper::WaapiHelperConstants::lightCallDeadlineMs)), true);
 		}
 		template <typename Callback>
 		void importAsync(const std::vector<Waapi::ImportItemRequest>& importItemsRequest, Import::ContainerNameExistsOption containerNameExistsOption, const juce::String& objectLanguage, const Callback& callback)
@@ -180,29 +223,40 @@ namespace AK::WwiseTransfer
 				return import(importItemsRequest, containerNameExistsOption, objectLanguage);
 			};
 
-			threadPool.addJob(new AsyncJob(onJobExecute, callback), true);
+			threadPool.addJob(new AsyncJob(onJobExecute, callback, nullptr, WaapiHelper::createRetryPolicy(WaapiHelper::getHeavyCallDeadlineMs(importItemsRequest.size()))), true);
 		}
 
 		template <typename Callback>
-		void getObjectAncestorsAndDescendantsAsync(const juce::String& objectPath, Callback& callback)
+		void getObjectAncestorsAndDescendantsAsync(const juce::String& objectPath, Callback& callback, std::shared_ptr<WaapiHelper::CancellationToken> cancellationToken = nullptr)
 		{
 			auto onJobExecute = [objectPath, this]()
 			{
 				return getObjectAncestorsAndDescendants(objectPath);
 			};
 
-			threadPool.addJob(new AsyncJob(onJobExecute, callback), true);
+			threadPool.addJob(new AsyncJob(onJobExecute, callback, std::move(cancellationToken)), true);
 		}
 
 		template <typename Callback>
-		void getObjectAncestorsAndDescendantsLegacyAsync(const juce::String& objectPath, Callback& callback)
+		void getObjectAncestorsAndDescendantsLegacyAsync(const juce::String& objectPath, Callback& callback, std::shared_ptr<WaapiHelper::CancellationToken> cancellationToken = nullptr)
 		{
 			auto onJobExecute = [objectPath, this]()
 			{
 				return getObjectAncestorsAndDescendantsLegacy(objectPath);
 			};
 
-			threadPool.addJob(new AsyncJob(onJobExecute, callback), true);
+			threadPool.addJob(new AsyncJob(onJobExecute, callback, std::move(cancellationToken)), true);
+		}
+
+		template <typename Callback>
+		void getObjectsByPathsAsync(const juce::String& rootPath, const std::set<juce::String>& objectPaths, Callback& callback, std::shared_ptr<WaapiHelper::CancellationToken> cancellationToken = nullptr)
+		{
+			auto onJobExecute = [rootPath, objectPaths, this]()
+			{
+				return getObjectsByPaths(rootPath, objectPaths);
+			};
+
+			threadPool.addJob(new AsyncJob(onJobExecute, callback, std::move(cancellationToken), WaapiHelper::createRetryPolicy(WaapiHelper::getHeavyCallDeadlineMs(objectPaths.size()))), true);
 		}
 
 		template <typename Callback>
@@ -213,11 +267,20 @@ namespace AK::WwiseTransfer
 				return getObject(objectPath);
 			};
 
-			threadPool.addJob(new AsyncJob(onJobExecute, callback), true);
+			threadPool.addJob(new AsyncJob(onJobExecute, callback, nullptr, WaapiHelper::createRetryPolicy(WaapiHelper::WaapiHelperConstants::lightCallDeadlineMs)), true);
 		}
 
 	private:
+		Waapi::Response<Waapi::ObjectResponseSet> fetchObjectAncestorsAndDescendants(const juce::String& objectPath);
+		Waapi::Response<Waapi::ObjectResponseSet> fetchObjectAncestorsAndDescendantsLegacy(const juce::String& objectPath);
+		Waapi::Response<Waapi::ObjectResponseSet> fetchObjectsByPaths(const juce::String& rootPath, const std::set<juce::String>& objectPaths);
+		Waapi::Response<Waapi::ObjectResponse> fetchObject(const juce::String& objectPath);
+
+		void logCall(const char* uri, bool status, double startTimeMs, const std::function<juce::String()>& getDetails);
+
 		juce::ThreadPool threadPool;
+		WaapiObjectCache objectCache;
+		std::atomic<Waapi::LogLevel> logLevel{Waapi::LogLevel::Info};
 	};
 
 	class WaapiClientWatcher
@@ -248,6 +311,8 @@ namespace AK::WwiseTransfer
 		uint64_t objectCreatedEventSubscriptionId{0};
 		uint64_t objectPostDeletedEventSubscriptionId{0};
 		uint64_t objectNameChangedEventSubscriptionId{0};
+		uint64_t objectChildAddedEventSubscriptionId{0};
+		uint64_t objectChildRemovedEventSubscriptionId{0};
 
 		// protected by guiMutex except for on construction
 		std::mutex guiMutex;
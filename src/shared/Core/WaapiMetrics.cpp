@@ -0,0 +1,272 @@
+/*----------------------------------------------------------------------------------------
+
+Copyright (c) 2025 AUDIOKINETIC Inc.
+
+This file is licensed to use under the license available at:
+https://github.com/audiokinetic/ReaWwise/blob/main/License.txt (the "License").
+You may not use this file except in compliance with the License.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations under the License.
+
+----------------------------------------------------------------------------------------*/
+
+#include "WaapiMetrics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <thread>
+
+namespace AK::WwiseTransfer
+{
+	namespace WaapiMetricsConstants
+	{
+		// Buckets grow by a factor of sqrt(2), starting at 0.1 ms. The last one holds everything above the bound of the one before it,
+		// 0.1 ms * 2^((latencyBucketCount - 2) / 2), which is about 14 minutes with 48 buckets.
+		constexpr double firstBucketUpperBoundMs = 0.1;
+		constexpr double bucketsPerDoubling = 2.0;
+	} // namespace WaapiMetricsConstants
+
+	namespace
+	{
+		thread_local bool isRetrying = false;
+
+		std::uint32_t hashUri(const char* uri)
+		{
+			// FNV-1a, zero marks free slots
+			std::uint32_t hash = 2166136261u;
+
+			for(auto character = uri; *character != '\0'; ++character)
+				hash = (hash ^ static_cast<std::uint8_t>(*character)) * 16777619u;
+
+			return hash == 0 ? 1 : hash;
+		}
+
+		double getPercentile(const std::array<std::uint64_t, WaapiMetrics::latencyBucketCount>& buckets, std::uint64_t count, double percentile)
+		{
+			if(count == 0)
+				return 0;
+
+			const auto rank = static_cast<std::uint64_t>(std::ceil(percentile * static_cast<double>(count)));
+
+			std::uint64_t cumulativeCount = 0;
+
+			for(int bucket = 0; bucket < WaapiMetrics::latencyBucketCount; ++bucket)
+			{
+				cumulativeCount += buckets[bucket];
+
+				if(cumulativeCount >= rank)
+					return WaapiMetrics::getBucketUpperBoundMs(bucket);
+			}
+
+			return WaapiMetrics::getBucketUpperBoundMs(WaapiMetrics::latencyBucketCount - 1);
+		}
+	} // namespace
+
+	WaapiMetrics::ScopedRetry::ScopedRetry(bool isRetry)
+		: previousValue(isRetrying)
+	{
+		isRetrying = isRetry;
+	}
+
+	WaapiMetrics::ScopedRetry::~ScopedRetry()
+	{
+		isRetrying = previousValue;
+	}
+
+	WaapiMetrics& WaapiMetrics::getInstance()
+	{
+		static WaapiMetrics instance;
+		return instance;
+	}
+
+	double WaapiMetrics::getBucketUpperBoundMs(int bucket)
+	{
+		using namespace WaapiMetricsConstants;
+		return firstBucketUpperBoundMs * std::pow(2.0, bucket / bucketsPerDoubling);
+	}
+
+	int WaapiMetrics::getBucket(double latencyMs)
+	{
+		using namespace WaapiMetricsConstants;
+
+		if(latencyMs <= firstBucketUpperBoundMs)
+			return 0;
+
+		const auto bucket = static_cast<int>(std::ceil(std::log2(latencyMs / firstBucketUpperBoundMs) * bucketsPerDoubling));
+
+		return juce::jlimit(0, latencyBucketCount - 1, bucket);
+	}
+
+	void WaapiMetrics::recordCall(const char* uri, bool status, double latencyMs, std::size_t requestBytes, std::size_t responseBytes)
+	{
+		auto procedure = findOrAddProcedure(uri);
+
+		if(procedure == nullptr)
+			return;
+
+		constexpr auto order = std::memory_order_relaxed;
+
+		procedure->calls.fetch_add(1, order);
+
+		if(!status)
+			procedure->failures.fetch_add(1, order);
+
+		if(isRetrying)
+			procedure->retries.fetch_add(1, order);
+
+		procedure->requestBytes.fetch_add(requestBytes, order);
+		procedure->responseBytes.fetch_add(responseBytes, order);
+		procedure->totalLatencyUs.fetch_add(static_cast<std::uint64_t>(latencyMs * 1000.0), order);
+		procedure->latencyBuckets[getBucket(latencyMs)].fetch_add(1, order);
+	}
+
+	WaapiMetrics::Procedure* WaapiMetrics::findOrAddProcedure(const char* uri)
+	{
+		const auto hash = hashUri(uri);
+
+		// Open addressing: a slot is claimed by setting its hash, then its uri is published through the ready flag
+		for(int probe = 0; probe < maxProcedures; ++probe)
+		{
+			auto& procedure = procedures[(hash + probe) % maxProcedures];
+
+			auto slotHash = procedure.hash.load(std::memory_order_acquire);
+
+			if(slotHash == 0)
+			{
+				if(procedure.hash.compare_exchange_strong(slotHash, hash, std::memory_order_acq_rel))
+				{
+					std::strncpy(procedure.uri, uri, maxUriLength - 1);
+					procedure.ready.store(true, std::memory_order_release);
+
+					return &procedure;
+				}
+			}
+
+			if(slotHash == hash)
+			{
+				// Another thread may still be publishing the uri
+				while(!procedure.ready.load(std::memory_order_acquire))
+					std::this_thread::yield();
+
+				if(std::strncmp(procedure.uri, uri, maxUriLength - 1) == 0)
+					return &procedure;
+			}
+		}
+
+		return nullptr;
+	}
+
+	std::vector<WaapiMetrics::ProcedureSnapshot> WaapiMetrics::getSnapshot() const
+	{
+		constexpr auto order = std::memory_order_relaxed;
+
+		std::vector<ProcedureSnapshot> snapshot;
+
+		for(const auto& procedure : procedures)
+		{
+			if(!procedure.ready.load(std::memory_order_acquire))
+				continue;
+
+			ProcedureSnapshot procedureSnapshot;
+			procedureSnapshot.uri = procedure.uri;
+			procedureSnapshot.calls = procedure.calls.load(order);
+			procedureSnapshot.failures = procedure.failures.load(order);
+			procedureSnapshot.retries = procedure.retries.load(order);
+			procedureSnapshot.requestBytes = procedure.requestBytes.load(order);
+			procedureSnapshot.responseBytes = procedure.responseBytes.load(order);
+			procedureSnapshot.totalLatencyMs = static_cast<double>(procedure.totalLatencyUs.load(order)) / 1000.0;
+
+			std::array<std::uint64_t, latencyBucketCount> buckets;
+			std::uint64_t bucketCount = 0;
+
+			for(int bucket = 0; bucket < latencyBucketCount; ++bucket)
+			{
+				buckets[bucket] = procedure.latencyBuckets[bucket].load(order);
+				bucketCount += buckets[bucket];
+			}
+
+			procedureSnapshot.p50LatencyMs = getPercentile(buckets, bucketCount, 0.50);
+			procedureSnapshot.p95LatencyMs = getPercentile(buckets, bucketCount, 0.95);
+			procedureSnapshot.p99LatencyMs = getPercentile(buckets, bucketCount, 0.99);
+
+			if(procedureSnapshot.calls > 0)
+				snapshot.push_back(std::move(procedureSnapshot));
+		}
+
+		std::sort(snapshot.begin(), snapshot.end(), [](const ProcedureSnapshot& first, const ProcedureSnapshot& second)
+			{
+				return first.uri < second.uri;
+			});
+
+		return snapshot;
+	}
+
+	void WaapiMetrics::reset()
+	{
+		constexpr auto order = std::memory_order_relaxed;
+
+		// Procedures keep their slot, only their statistics are cleared
+		for(auto& procedure : procedures)
+		{
+			procedure.calls.store(0, order);
+			procedure.failures.store(0, order);
+			procedure.retries.store(0, order);
+			procedure.requestBytes.store(0, order);
+			procedure.responseBytes.store(0, order);
+			procedure.totalLatencyUs.store(0, order);
+
+			for(auto& bucket : procedure.latencyBuckets)
+				bucket.store(0, order);
+		}
+	}
+
+	juce::var WaapiMetrics::toVar() const
+	{
+		juce::Array<juce::var> procedureVars;
+
+		for(const auto& procedure : getSnapshot())
+		{
+			auto procedureObject = new juce::DynamicObject();
+			procedureObject->setProperty("uri", procedure.uri);
+			procedureObject->setProperty("calls", static_cast<juce::int64>(procedure.calls));
+			procedureObject->setProperty("failures", static_cast<juce::int64>(procedure.failures));
+			procedureObject->setProperty("retries", static_cast<juce::int64>(procedure.retries));
+			procedureObject->setProperty("requestBytes", static_cast<juce::int64>(procedure.requestBytes));
+			procedureObject->setProperty("responseBytes", static_cast<juce::int64>(procedure.responseBytes));
+			procedureObject->setProperty("totalLatencyMs", procedure.totalLatencyMs);
+			procedureObject->setProperty("p50LatencyMs", procedure.p50LatencyMs);
+			procedureObject->setProperty("p95LatencyMs", procedure.p95LatencyMs);
+			procedureObject->setProperty("p99LatencyMs", procedure.p99LatencyMs);
+
+			procedureVars.add(juce::var(procedureObject));
+		}
+
+		return procedureVars;
+	}
+
+	juce::String WaapiMetrics::toText() const
+	{
+		const auto snapshot = getSnapshot();
+
+		if(snapshot.empty())
+			return "No WAAPI calls recorded.";
+
+		juce::String text;
+
+		for(const auto& procedure : snapshot)
+		{
+			text << procedure.uri << juce::newLine
+				 << "  calls: " << juce::String(procedure.calls) << ", failures: " << juce::String(procedure.failures) << ", retries: " << juce::String(procedure.retries) << juce::newLine
+				 << "  latency p50: " << juce::String(procedure.p50LatencyMs, 1) << " ms, p95: " << juce::String(procedure.p95LatencyMs, 1)
+				 << " ms, p99: " << juce::String(procedure.p99LatencyMs, 1) << " ms, total: " << juce::String(procedure.totalLatencyMs, 1) << " ms" << juce::newLine
+				 << "  sent: " << juce::File::descriptionOfSizeInBytes(static_cast<juce::int64>(procedure.requestBytes))
+				 << ", received: " << juce::File::descriptionOfSizeInBytes(static_cast<juce::int64>(procedure.responseBytes)) << juce::newLine;
+		}
+
+		return text;
+	}
+} // namespace AK::WwiseTransfer
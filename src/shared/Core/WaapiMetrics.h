@@ -0,0 +1,94 @@
+/*----------------------------------------------------------------------------------------
+
+Copyright (c) 2025 AUDIOKINETIC Inc.
+
+This file is licensed to use under the license available at:
+https://github.com/audiokinetic/ReaWwise/blob/main/License.txt (the "License").
+You may not use this file except in compliance with the License.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations under the License.
+
+----------------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <juce_core/juce_core.h>
+#include <vector>
+
+namespace AK::WwiseTransfer
+{
+	// Per procedure statistics of the waapi calls made by every client of the process.
+	// Recording never locks, it may be done from any thread while another thread takes a snapshot.
+	class WaapiMetrics
+	{
+	public:
+		static constexpr int maxProcedures = 64;
+		static constexpr int maxUriLength = 96;
+		static constexpr int latencyBucketCount = 48;
+
+		struct ProcedureSnapshot
+		{
+			juce::String uri;
+			std::uint64_t calls{0};
+			std::uint64_t failures{0};
+			std::uint64_t retries{0};
+			std::uint64_t requestBytes{0};
+			std::uint64_t responseBytes{0};
+			double totalLatencyMs{0};
+			double p50LatencyMs{0};
+			double p95LatencyMs{0};
+			double p99LatencyMs{0};
+		};
+
+		// Calls made while an instance is alive with isRetry set are counted as retries
+		class ScopedRetry
+		{
+		public:
+			explicit ScopedRetry(bool isRetry);
+			~ScopedRetry();
+
+		private:
+			bool previousValue;
+		};
+
+		static WaapiMetrics& getInstance();
+
+		void recordCall(const char* uri, bool status, double latencyMs, std::size_t requestBytes, std::size_t responseBytes);
+
+		std::vector<ProcedureSnapshot> getSnapshot() const;
+		void reset();
+
+		juce::var toVar() const;
+		juce::String toText() const;
+
+		// Upper bound of the latency bucket, in milliseconds
+		static double getBucketUpperBoundMs(int bucket);
+		static int getBucket(double latencyMs);
+
+	private:
+		struct Procedure
+		{
+			std::atomic<std::uint32_t> hash{0};
+			std::atomic<bool> ready{false};
+			char uri[maxUriLength]{};
+
+			std::atomic<std::uint64_t> calls{0};
+			std::atomic<std::uint64_t> failures{0};
+			std::atomic<std::uint64_t> retries{0};
+			std::atomic<std::uint64_t> requestBytes{0};
+			std::atomic<std::uint64_t> responseBytes{0};
+			std::atomic<std::uint64_t> totalLatencyUs{0};
+			std::array<std::atomic<std::uint64_t>, latencyBucketCount> latencyBuckets{};
+		};
+
+		Procedure* findOrAddProcedure(const char* uri);
+
+		std::array<Procedure, maxProcedures> procedures;
+	};
+} // namespace AK::WwiseTransfer
@@ -0,0 +1,464 @@
+/*----------------------------------------------------------------------------------------
+
+Copyright (c) 2025 AUDIOKINETIC Inc.
+
+This file is licensed to use under the license available at:
+https://github.com/audiokinetic/ReaWwise/blob/main/License.txt (the "License").
+You may not use this file except in compliance with the License.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations under the License.
+
+----------------------------------------------------------------------------------------*/
+
+#include "WaapiObjectCache.h"
+
+namespace AK::WwiseTransfer
+{
+	namespace
+	{
+		juce::String getParentPath(const juce::String& objectPath)
+		{
+			return objectPath.upToLastOccurrenceOf("\\", false, false);
+		}
+
+		// Calls function for every ancestor of the path, from the top level, then for the path itself
+		template <typename Function>
+		void forEachAncestorAndSelf(const juce::String& objectPath, Function function)
+		{
+			for(int index = objectPath.indexOfChar(1, '\\'); index > 0; index = objectPath.indexOfChar(index + 1, '\\'))
+				function(objectPath.substring(0, index));
+
+			function(objectPath);
+		}
+
+		const juce::String& getKey(const juce::String& key)
+		{
+			return key;
+		}
+
+		template <typename Value>
+		const juce::String& getKey(const std::pair<const juce::String, Value>& entry)
+		{
+			return entry.first;
+		}
+
+		// Removes the entry of the path and the entries of its descendants from a container sorted by path, calling function on each one before it is removed.
+		// The path and its descendants are not contiguous in the sort order ("A B" sorts between "A" and "A\B"), so they are looked up separately.
+		template <typename Container, typename Function>
+		void extractSubtree(Container& container, const juce::String& objectPath, Function function)
+		{
+			auto it = container.find(objectPath);
+
+			if(it != container.end())
+			{
+				function(*it);
+				container.erase(it);
+			}
+
+			const auto descendantsPrefix = objectPath + "\\";
+
+			for(it = container.lower_bound(descendantsPrefix); it != container.end() && getKey(*it).startsWith(descendantsPrefix);)
+			{
+				function(*it);
+				it = container.erase(it);
+			}
+		}
+	} // namespace
+
+	std::optional<Waapi::ObjectResponseSet> WaapiObjectCache::getObjectAncestorsAndDescendants(const juce::String& objectPath) const
+	{
+		std::lock_guard lock(mutex);
+
+		if(!isCovered(objectPath) && !isKnownMissing(objectPath))
+			return std::nullopt;
+
+		Waapi::ObjectResponseSet objects;
+
+		forEachAncestorAndSelf(objectPath, [this, &objects](const juce::String& path)
+			{
+				auto it = objectsByPath.find(path);
+
+				if(it != objectsByPath.end())
+					objects.insert(it->second);
+			});
+
+		const auto descendantsPrefix = objectPath + "\\";
+
+		for(auto it = objectsByPath.lower_bound(descendantsPrefix); it != objectsByPath.end() && it->first.startsWith(descendantsPrefix); ++it)
+			objects.insert(it->second);
+
+		return objects;
+	}
+
+	std::optional<Waapi::ObjectResponse> WaapiObjectCache::getObject(const juce::String& objectPath) const
+	{
+		std::lock_guard lock(mutex);
+
+		auto it = objectsByPath.find(objectPath);
+
+		if(it != objectsByPath.end())
+			return it->second;
+
+		if(isCovered(objectPath) || isKnownMissing(objectPath))
+			return Waapi::ObjectResponse();
+
+		return std::nullopt;
+	}
+
+	std::optional<Waapi::ObjectResponseSet> WaapiObjectCache::getObjects(const std::set<juce::String>& objectPaths) const
+	{
+		std::lock_guard lock(mutex);
+
+		Waapi::ObjectResponseSet objects;
+
+		for(const auto& objectPath : objectPaths)
+		{
+			auto it = objectsByPath.find(objectPath);
+
+			if(it != objectsByPath.end())
+				objects.insert(it->second);
+			else if(!isCovered(objectPath) && !isKnownMissing(objectPath))
+				return std::nullopt;
+		}
+
+		return objects;
+	}
+
+	std::uint64_t WaapiObjectCache::getRevision() const
+	{
+		std::lock_guard lock(mutex);
+
+		return revision;
+	}
+
+	void WaapiObjectCache::addObjectAncestorsAndDescendants(const juce::String& objectPath, const Waapi::ObjectResponseSet& objects, std::uint64_t queryRevision)
+	{
+		std::lock_guard lock(mutex);
+
+		// Events were received while the query was running, the result may not reflect them
+		if(queryRevision != revision)
+			return;
+
+		bool objectFound = false;
+		bool objectFoundWithDifferentCase = false;
+
+		for(const auto& object : objects)
+		{
+			insertObject(object);
+
+			if(object.path == objectPath)
+				objectFound = true;
+			else if(object.path.equalsIgnoreCase(objectPath))
+				objectFoundWithDifferentCase = true;
+		}
+
+		// Wwise paths are case insensitive but the cache is not. Leave paths that differ only by case to Wwise.
+		if(objectFound)
+			subtreeRoots.insert(objectPath);
+		else if(!objectFoundWithDifferentCase)
+			missingPaths.insert(objectPath);
+	}
+
+	void WaapiObjectCache::addObjects(const std::set<juce::String>& objectPaths, const Waapi::ObjectResponseSet& objects, std::uint64_t queryRevision)
+	{
+		std::lock_guard lock(mutex);
+
+		if(queryRevision != revision)
+			return;
+
+		std::set<juce::String> foundPaths;
+
+		for(const auto& object : objects)
+		{
+			insertObject(object);
+			foundPaths.insert(object.path.toLowerCase());
+		}
+
+		for(const auto& objectPath : objectPaths)
+		{
+			if(foundPaths.count(objectPath.toLowerCase()) == 0)
+				missingPaths.insert(objectPath);
+		}
+	}
+
+	void WaapiObjectCache::onObjectCreated(const Waapi::ObjectResponse& object, const juce::String& parentId)
+	{
+		std::lock_guard lock(mutex);
+
+		++revision;
+
+		auto objectPath = object.path;
+
+		if(objectPath.isEmpty())
+		{
+			// The parent of a relevant object is always mirrored
+			auto it = pathsById.find(parentId);
+
+			if(it == pathsById.end())
+				return;
+
+			objectPath = it->second + "\\" + object.name;
+		}
+
+		if(!isRelevant(objectPath))
+			return;
+
+		auto createdObject = object;
+		createdObject.path = objectPath;
+		insertObject(createdObject);
+
+		// A new object has no children yet, so its whole subtree is known
+		if(missingPaths.erase(objectPath) > 0)
+			subtreeRoots.insert(objectPath);
+	}
+
+	void WaapiObjectCache::onObjectDeleted(const Waapi::ObjectResponse& object)
+	{
+		std::lock_guard lock(mutex);
+
+		++revision;
+
+		const auto objectPath = findPath(object);
+
+		if(objectPath.isNotEmpty())
+			removeSubtree(objectPath);
+	}
+
+	void WaapiObjectCache::onObjectRenamed(const Waapi::ObjectResponse& object, const juce::String& oldName)
+	{
+		std::lock_guard lock(mutex);
+
+		++revision;
+
+		juce::String oldPath;
+		juce::String newPath;
+
+		auto it = pathsById.find(object.id);
+
+		if(it != pathsById.end())
+		{
+			oldPath = it->second;
+			newPath = object.path.isNotEmpty() ? object.path : getParentPath(oldPath) + "\\" + object.name;
+		}
+		else if(object.path.isNotEmpty() && oldName.isNotEmpty())
+		{
+			newPath = object.path;
+			oldPath = getParentPath(newPath) + "\\" + oldName;
+		}
+		else
+		{
+			// The object is not mirrored and the event does not say where it was, nothing in the cache can be trusted anymore
+			clearLocked();
+			return;
+		}
+
+		if(oldPath != newPath)
+			renameSubtree(oldPath, newPath);
+	}
+
+	void WaapiObjectCache::onChildAdded(const Waapi::ObjectResponse& child)
+	{
+		std::lock_guard lock(mutex);
+
+		++revision;
+
+		if(child.path.isEmpty())
+		{
+			clearLocked();
+			return;
+		}
+
+		if(!isRelevant(child.path))
+			return;
+
+		// Newly created objects were already added by onObjectCreated
+		auto it = objectsByPath.find(child.path);
+
+		if(it != objectsByPath.end() && it->second.id == child.id)
+			return;
+
+		// An object was moved into a mirrored part of the hierarchy, its descendants are unknown
+		clearLocked();
+	}
+
+	void WaapiObjectCache::onChildRemoved(const Waapi::ObjectResponse& child)
+	{
+		std::lock_guard lock(mutex);
+
+		++revision;
+
+		// Only the id can be trusted here, the path may already be the new location of a moved object
+		auto it = pathsById.find(child.id);
+
+		if(it != pathsById.end())
+			removeSubtree(it->second);
+	}
+
+	void WaapiObjectCache::onObjectsImported(const Waapi::ObjectResponseSet& objects)
+	{
+		std::lock_guard lock(mutex);
+
+		++revision;
+
+		for(const auto& object : objects)
+		{
+			const auto objectPath = findPath(object);
+
+			if(objectPath.isNotEmpty())
+				forgetSubtree(objectPath);
+		}
+	}
+
+	void WaapiObjectCache::clear()
+	{
+		std::lock_guard lock(mutex);
+
+		clearLocked();
+	}
+
+	bool WaapiObjectCache::isCovered(const juce::String& objectPath) const
+	{
+		bool covered = false;
+
+		forEachAncestorAndSelf(objectPath, [this, &covered](const juce::String& path)
+			{
+				covered = covered || subtreeRoots.count(path) > 0;
+			});
+
+		return covered;
+	}
+
+	bool WaapiObjectCache::isKnownMissing(const juce::String& objectPath) const
+	{
+		bool missing = false;
+
+		forEachAncestorAndSelf(objectPath, [this, &missing](const juce::String& path)
+			{
+				missing = missing || missingPaths.count(path) > 0;
+			});
+
+		return missing;
+	}
+
+	bool WaapiObjectCache::isRelevant(const juce::String& objectPath) const
+	{
+		if(isCovered(getParentPath(objectPath)) || missingPaths.count(objectPath) > 0)
+			return true;
+
+		// Ancestors of missing paths are mirrored
+		const auto descendantsPrefix = objectPath + "\\";
+		auto it = missingPaths.lower_bound(descendantsPrefix);
+
+		return it != missingPaths.end() && it->startsWith(descendantsPrefix);
+	}
+
+	juce::String WaapiObjectCache::findPath(const Waapi::ObjectResponse& object) const
+	{
+		auto it = pathsById.find(object.id);
+
+		if(it != pathsById.end())
+			return it->second;
+
+		return object.path;
+	}
+
+	void WaapiObjectCache::insertObject(const Waapi::ObjectResponse& object)
+	{
+		if(object.path.isEmpty())
+			return;
+
+		objectsByPath[object.path] = object;
+
+		if(object.id.isNotEmpty())
+			pathsById[object.id] = object.path;
+	}
+
+	void WaapiObjectCache::removeSubtree(const juce::String& objectPath)
+	{
+		extractSubtree(objectsByPath, objectPath, [this](const auto& entry)
+			{
+				pathsById.erase(entry.second.id);
+			});
+
+		// Mirrored subtrees that were removed are now known to be missing
+		extractSubtree(subtreeRoots, objectPath, [this](const juce::String& subtreeRoot)
+			{
+				missingPaths.insert(subtreeRoot);
+			});
+	}
+
+	void WaapiObjectCache::forgetSubtree(const juce::String& objectPath)
+	{
+		extractSubtree(objectsByPath, objectPath, [this](const auto& entry)
+			{
+				pathsById.erase(entry.second.id);
+			});
+
+		// Unlike a removed subtree, the forgotten one is neither mirrored nor missing. Mirrored subtrees containing it are not complete anymore.
+		auto noop = [](const juce::String&)
+		{
+		};
+
+		extractSubtree(subtreeRoots, objectPath, noop);
+		extractSubtree(missingPaths, objectPath, noop);
+
+		forEachAncestorAndSelf(getParentPath(objectPath), [this](const juce::String& path)
+			{
+				subtreeRoots.erase(path);
+			});
+	}
+
+	void WaapiObjectCache::renameSubtree(const juce::String& oldPath, const juce::String& newPath)
+	{
+		// Paths known to be missing under the new name may exist now
+		extractSubtree(missingPaths, newPath, [](const juce::String&)
+			{
+			});
+
+		auto rename = [&oldPath, &newPath](const juce::String& path)
+		{
+			return newPath + path.substring(oldPath.length());
+		};
+
+		std::vector<Waapi::ObjectResponse> renamedObjects;
+
+		extractSubtree(objectsByPath, oldPath, [&renamedObjects, &rename](const auto& entry)
+			{
+				auto& renamedObject = renamedObjects.emplace_back(entry.second);
+				renamedObject.path = rename(renamedObject.path);
+			});
+
+		for(auto& renamedObject : renamedObjects)
+		{
+			if(renamedObject.path == newPath)
+				renamedObject.name = newPath.fromLastOccurrenceOf("\\", false, false);
+
+			insertObject(renamedObject);
+		}
+
+		for(auto* paths : {&subtreeRoots, &missingPaths})
+		{
+			std::vector<juce::String> renamedPaths;
+
+			extractSubtree(*paths, oldPath, [&renamedPaths, &rename](const juce::String& path)
+				{
+					renamedPaths.emplace_back(rename(path));
+				});
+
+			paths->insert(renamedPaths.begin(), renamedPaths.end());
+		}
+	}
+
+	void WaapiObjectCache::clearLocked()
+	{
+		objectsByPath.clear();
+		pathsById.clear();
+		subtreeRoots.clear();
+		missingPaths.clear();
+
+		++revision;
+	}
+} // namespace AK::WwiseTransfer
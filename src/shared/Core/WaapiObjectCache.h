@@ -0,0 +1,87 @@
+/*----------------------------------------------------------------------------------------
+
+Copyright (c) 2025 AUDIOKINETIC Inc.
+
+This file is licensed to use under the license available at:
+https://github.com/audiokinetic/ReaWwise/blob/main/License.txt (the "License").
+You may not use this file except in compliance with the License.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations under the License.
+
+----------------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "Model/Waapi.h"
+
+#include <cstdint>
+#include <juce_core/juce_core.h>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <unordered_map>
+
+namespace AK::WwiseTransfer
+{
+	// Client side mirror of the parts of the Wwise object graph that were queried, keyed by path and id.
+	// It is filled by object queries and kept up to date by object events, so repeated queries can be answered from memory.
+	class WaapiObjectCache
+	{
+	public:
+		// Returns the object, its existing ancestors and its descendants if the cache knows all of them
+		std::optional<Waapi::ObjectResponseSet> getObjectAncestorsAndDescendants(const juce::String& objectPath) const;
+
+		// Returns the object if the cache knows it, or an empty object if the cache knows it does not exist
+		std::optional<Waapi::ObjectResponse> getObject(const juce::String& objectPath) const;
+
+		// Returns the existing objects among the paths if the cache knows whether each of them exists
+		std::optional<Waapi::ObjectResponseSet> getObjects(const std::set<juce::String>& objectPaths) const;
+
+		// Changes every time an event modifies the cache. Query results started at an older revision are discarded since they may be stale.
+		std::uint64_t getRevision() const;
+
+		void addObjectAncestorsAndDescendants(const juce::String& objectPath, const Waapi::ObjectResponseSet& objects, std::uint64_t revision);
+
+		// Records the result of a query for specific paths. The paths must include the ancestors of each path.
+		void addObjects(const std::set<juce::String>& objectPaths, const Waapi::ObjectResponseSet& objects, std::uint64_t revision);
+
+		void onObjectCreated(const Waapi::ObjectResponse& object, const juce::String& parentId);
+		void onObjectDeleted(const Waapi::ObjectResponse& object);
+		void onObjectRenamed(const Waapi::ObjectResponse& object, const juce::String& oldName);
+		void onChildAdded(const Waapi::ObjectResponse& child);
+		void onChildRemoved(const Waapi::ObjectResponse& child);
+
+		// No event reports the audio files an import replaced. Forgets the imported objects so that they are queried again.
+		void onObjectsImported(const Waapi::ObjectResponseSet& objects);
+
+		void clear();
+
+	private:
+		bool isCovered(const juce::String& objectPath) const;
+		bool isKnownMissing(const juce::String& objectPath) const;
+		bool isRelevant(const juce::String& objectPath) const;
+		juce::String findPath(const Waapi::ObjectResponse& object) const;
+		void insertObject(const Waapi::ObjectResponse& object);
+		void removeSubtree(const juce::String& objectPath);
+		void renameSubtree(const juce::String& oldPath, const juce::String& newPath);
+		void forgetSubtree(const juce::String& objectPath);
+		void clearLocked();
+
+		mutable std::mutex mutex;
+
+		std::map<juce::String, Waapi::ObjectResponse> objectsByPath;
+		std::unordered_map<juce::String, juce::String> pathsById;
+
+		// Objects whose whole subtree is mirrored. Their ancestors are mirrored as well.
+		std::set<juce::String> subtreeRoots;
+
+		// Paths known not to exist, along with their descendants. Their existing ancestors are mirrored.
+		std::set<juce::String> missingPaths;
+
+		std::uint64_t revision{0};
+	};
+} // namespace AK::WwiseTransfer
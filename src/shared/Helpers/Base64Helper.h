@@ -0,0 +1,209 @@
+/*----------------------------------------------------------------------------------------
+
+Copyright (c) 2025 AUDIOKINETIC Inc.
+
+This file is licensed to use under the license available at:
+https://github.com/audiokinetic/ReaWwise/blob/main/License.txt (the "License").
+You may not use this file except in compliance with the License.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations under the License.
+
+----------------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <juce_core/juce_core.h>
+#include <string>
+
+#if JUCE_INTEL
+#include <immintrin.h>
+#endif
+
+#if JUCE_INTEL && !JUCE_MSVC
+#define AK_WWISE_TRANSFER_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define AK_WWISE_TRANSFER_TARGET_AVX2
+#endif
+
+namespace AK::WwiseTransfer::Base64Helper
+{
+	namespace Base64HelperConstants
+	{
+		constexpr const char* const alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	} // namespace Base64HelperConstants
+
+	enum class Kernel
+	{
+		Scalar,
+		SSE2,
+		AVX2
+	};
+
+	// Number of characters produced when encoding size bytes, padding included
+	constexpr std::size_t getEncodedSize(std::size_t size)
+	{
+		return (size + 2) / 3 * 4;
+	}
+
+	inline void encodeScalar(const std::uint8_t* input, std::size_t size, char* output)
+	{
+		using namespace Base64HelperConstants;
+
+		std::size_t i = 0;
+		for(; i + 3 <= size; i += 3)
+		{
+			const std::uint32_t value = (input[i] << 16) | (input[i + 1] << 8) | input[i + 2];
+
+			*output++ = alphabet[(value >> 18) & 0x3f];
+			*output++ = alphabet[(value >> 12) & 0x3f];
+			*output++ = alphabet[(value >> 6) & 0x3f];
+			*output++ = alphabet[value & 0x3f];
+		}
+
+		const auto remaining = size - i;
+
+		if(remaining > 0)
+		{
+			const std::uint32_t value = (input[i] << 16) | (remaining == 2 ? input[i + 1] << 8 : 0);
+
+			*output++ = alphabet[(value >> 18) & 0x3f];
+			*output++ = alphabet[(value >> 12) & 0x3f];
+			*output++ = remaining == 2 ? alphabet[(value >> 6) & 0x3f] : '=';
+			*output++ = '=';
+		}
+	}
+
+#if JUCE_INTEL
+	// Encodes 12 bytes into 16 characters per iteration. Returns the number of bytes consumed, always a multiple of 3.
+	inline std::size_t encodeSSE2(const std::uint8_t* input, std::size_t size, char* output)
+	{
+		std::size_t i = 0;
+		for(; i + 12 <= size; i += 12, output += 16)
+		{
+			auto loadTriplet = [input = input + i](int index)
+			{
+				return static_cast<int>((input[index * 3] << 16) | (input[index * 3 + 1] << 8) | input[index * 3 + 2]);
+			};
+
+			const auto triplets = _mm_setr_epi32(loadTriplet(0), loadTriplet(1), loadTriplet(2), loadTriplet(3));
+
+			// Spread the four 6 bit indices of each triplet over the bytes of its 32 bit lane, in output order
+			auto indices = _mm_and_si128(_mm_srli_epi32(triplets, 18), _mm_set1_epi32(0x0000003f));
+			indices = _mm_or_si128(indices, _mm_and_si128(_mm_srli_epi32(triplets, 4), _mm_set1_epi32(0x00003f00)));
+			indices = _mm_or_si128(indices, _mm_and_si128(_mm_slli_epi32(triplets, 10), _mm_set1_epi32(0x003f0000)));
+			indices = _mm_or_si128(indices, _mm_and_si128(_mm_slli_epi32(triplets, 24), _mm_set1_epi32(0x3f000000)));
+
+			// Translate indices to characters: 'A' + index, then correct the offset of each range past 'Z'
+			auto result = _mm_add_epi8(indices, _mm_set1_epi8('A'));
+			result = _mm_add_epi8(result, _mm_and_si128(_mm_cmpgt_epi8(indices, _mm_set1_epi8(25)), _mm_set1_epi8('a' - 26 - 'A')));
+			result = _mm_add_epi8(result, _mm_and_si128(_mm_cmpgt_epi8(indices, _mm_set1_epi8(51)), _mm_set1_epi8(('0' - 52) - ('a' - 26))));
+			result = _mm_add_epi8(result, _mm_and_si128(_mm_cmpgt_epi8(indices, _mm_set1_epi8(61)), _mm_set1_epi8(('+' - 62) - ('0' - 52))));
+			result = _mm_add_epi8(result, _mm_and_si128(_mm_cmpgt_epi8(indices, _mm_set1_epi8(62)), _mm_set1_epi8(('/' - 63) - ('+' - 62))));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output), result);
+		}
+
+		return i;
+	}
+
+	// Encodes 24 bytes into 32 characters per iteration, see Muła & Lemire, "Faster Base64 Encoding and Decoding Using AVX2 Instructions".
+	// Returns the number of bytes consumed, always a multiple of 3.
+	AK_WWISE_TRANSFER_TARGET_AVX2 inline std::size_t encodeAVX2(const std::uint8_t* input, std::size_t size, char* output)
+	{
+		const auto shuffle = _mm256_set_epi8(
+			10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+			10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+
+		const auto shiftLut = _mm256_setr_epi8(
+			'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+			'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+		std::size_t i = 0;
+
+		// Each 128 bit load reads 16 bytes but only uses 12, stop early enough to never read past the input
+		for(; i + 28 <= size; i += 24, output += 32)
+		{
+			const auto low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+			const auto high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 12));
+
+			auto in = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+			in = _mm256_shuffle_epi8(in, shuffle);
+
+			// Extract the four 6 bit indices of each triplet into their own byte
+			const auto t0 = _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00)), _mm256_set1_epi32(0x04000040));
+			const auto t1 = _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0)), _mm256_set1_epi32(0x01000010));
+			const auto indices = _mm256_or_si256(t0, t1);
+
+			// Map each index to the offset of its range, then add the offset to the index
+			auto lutIndices = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+			lutIndices = _mm256_or_si256(lutIndices, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+
+			const auto result = _mm256_add_epi8(_mm256_shuffle_epi8(shiftLut, lutIndices), indices);
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(output), result);
+		}
+
+		return i;
+	}
+#endif
+
+	inline bool isKernelSupported(Kernel kernel)
+	{
+		switch(kernel)
+		{
+		case Kernel::Scalar:
+			return true;
+#if JUCE_INTEL
+		case Kernel::SSE2:
+			return juce::SystemStats::hasSSE2();
+		case Kernel::AVX2:
+			return juce::SystemStats::hasAVX2();
+#endif
+		default:
+			return false;
+		}
+	}
+
+	inline Kernel getDefaultKernel()
+	{
+		static const Kernel defaultKernel = isKernelSupported(Kernel::AVX2) ? Kernel::AVX2 : isKernelSupported(Kernel::SSE2) ? Kernel::SSE2
+		                                                                                                                      : Kernel::Scalar;
+
+		return defaultKernel;
+	}
+
+	// Encodes size bytes of data into output, which must hold at least getEncodedSize(size) characters.
+	// Output is padded with '=' when size is not a multiple of 3, so chunks that are multiples of 3 can be encoded independently and concatenated.
+	inline void encode(const void* data, std::size_t size, char* output, Kernel kernel)
+	{
+		auto input = static_cast<const std::uint8_t*>(data);
+		std::size_t consumed = 0;
+
+#if JUCE_INTEL
+		if(kernel == Kernel::AVX2)
+			consumed = encodeAVX2(input, size, output);
+		else if(kernel == Kernel::SSE2)
+			consumed = encodeSSE2(input, size, output);
+#endif
+
+		encodeScalar(input + consumed, size - consumed, output + getEncodedSize(consumed));
+	}
+
+	inline void encode(const void* data, std::size_t size, char* output)
+	{
+		encode(data, size, output, getDefaultKernel());
+	}
+
+	inline std::string encode(const void* data, std::size_t size)
+	{
+		std::string output(getEncodedSize(size), '\0');
+		encode(data, size, output.data());
+
+		return output;
+	}
+} // namespace AK::WwiseTransfer::Base64Helper
@@ -16,23 +16,26 @@ specific language governing permissions and limitations under the License.
 #pragma once
 
 #include <juce_gui_basics/juce_gui_basics.h>
-#include <set>
+#include <vector>
 
 namespace AK::WwiseTransfer::FileHelper
 {
-	inline int countModifiedFilesInDirectoriesSince(const std::set<juce::File>& directorySet, const juce::Time& lastWriteTime)
+	// Returns the files that are missing or that were not written to since the given time.
+	// Only the given files are checked, so the cost does not depend on what else their directories contain.
+	inline std::vector<juce::File> getFilesNotModifiedSince(const std::vector<juce::File>& files, const juce::Time& time)
 	{
-		int modifiedFiles = 0;
+		// Some file systems only store modification times to the second
+		const juce::Time threshold(time.toMilliseconds() / 1000 * 1000);
 
-		for(const auto& directory : directorySet)
+		std::vector<juce::File> filesNotModified;
+
+		for(const auto& file : files)
 		{
-			for(const auto& file : directory.findChildFiles(juce::File::TypesOfFileToFind::findFiles, false))
-			{
-				if(file.getLastModificationTime() > lastWriteTime)
-					++modifiedFiles;
-			}
+			// Missing files have a modification time of zero
+			if(file.getLastModificationTime() < threshold)
+				filesNotModified.push_back(file);
 		}
 
-		return modifiedFiles;
+		return filesNotModified;
 	}
 } // namespace AK::WwiseTransfer::FileHelper
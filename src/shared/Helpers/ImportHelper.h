@@ -18,9 +18,14 @@ specific language governing permissions and limitations under the License.
 #include "Helpers/WwiseHelper.h"
 #include "Model/IDs.h"
 #include "Model/Import.h"
+#include "Model/Waapi.h"
 
 #include <AK/Tools/Common/AkFNVHash.h>
+#include <algorithm>
+#include <cstdint>
 #include <juce_gui_basics/juce_gui_basics.h>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace AK::WwiseTransfer::ImportHelper
 {
@@ -82,7 +87,8 @@ namespace AK::WwiseTransfer::ImportHelper
 
 	inline juce::ValueTree previewItemNodeToValueTree(const juce::String& path, Import::PreviewItemNode previewItem)
 	{
-		juce::ValueTree valueTree(path);
+		juce::ValueTree valueTree(IDs::previewItem);
+		valueTree.setProperty(IDs::objectPath, path, nullptr);
 		valueTree.setProperty(IDs::objectName, previewItem.name, nullptr);
 		valueTree.setProperty(IDs::objectType, juce::VariantConverter<Wwise::ObjectType>::toVar(previewItem.type), nullptr);
 		valueTree.setProperty(IDs::objectStatus, juce::VariantConverter<Import::ObjectStatus>::toVar(previewItem.objectStatus), nullptr);
@@ -94,6 +100,79 @@ namespace AK::WwiseTransfer::ImportHelper
 		return valueTree;
 	}
 
+	// Updates target in place so that it becomes equivalent to source. Children are matched by their object path, and children sharing a path
+	// by their position among them: vanished children are removed, new ones are added and only properties that differ are set, so listeners
+	// are only notified of actual changes and untouched nodes keep their identity.
+	inline void applyValueTreeDiff(juce::ValueTree target, const juce::ValueTree& source)
+	{
+		for(int i = target.getNumProperties() - 1; i >= 0; --i)
+		{
+			auto propertyName = target.getPropertyName(i);
+
+			if(!source.hasProperty(propertyName))
+				target.removeProperty(propertyName, nullptr);
+		}
+
+		for(int i = 0; i < source.getNumProperties(); ++i)
+		{
+			auto propertyName = source.getPropertyName(i);
+			const auto& value = source[propertyName];
+
+			if(!target.hasProperty(propertyName) || target[propertyName] != value)
+				target.setProperty(propertyName, value, nullptr);
+		}
+
+		std::unordered_map<juce::String, std::size_t> sourceChildCounts;
+		sourceChildCounts.reserve(static_cast<std::size_t>(source.getNumChildren()));
+
+		for(const auto& sourceChild : source)
+			++sourceChildCounts[sourceChild[IDs::objectPath].toString()];
+
+		std::unordered_map<juce::String, std::vector<juce::ValueTree>> targetChildren;
+		targetChildren.reserve(static_cast<std::size_t>(target.getNumChildren()));
+
+		std::vector<juce::ValueTree> vanishedChildren;
+
+		for(const auto& targetChild : target)
+		{
+			auto path = targetChild[IDs::objectPath].toString();
+			auto& children = targetChildren[path];
+
+			if(children.size() < sourceChildCounts[path])
+				children.push_back(targetChild);
+			else
+				vanishedChildren.push_back(targetChild);
+		}
+
+		for(const auto& vanishedChild : vanishedChildren)
+			target.removeChild(vanishedChild, nullptr);
+
+		std::unordered_map<juce::String, std::size_t> occurrences;
+		occurrences.reserve(sourceChildCounts.size());
+
+		for(int i = 0; i < source.getNumChildren(); ++i)
+		{
+			auto sourceChild = source.getChild(i);
+			auto path = sourceChild[IDs::objectPath].toString();
+
+			const auto& children = targetChildren[path];
+			const auto occurrence = occurrences[path]++;
+
+			if(occurrence >= children.size())
+			{
+				target.addChild(sourceChild.createCopy(), i, nullptr);
+				continue;
+			}
+
+			const auto& targetChild = children[occurrence];
+
+			if(target.getChild(i) != targetChild)
+				target.moveChild(target.indexOf(targetChild), i, nullptr);
+
+			applyValueTreeDiff(targetChild, sourceChild);
+		}
+	}
+
 	inline std::vector<Import::HierarchyMappingNode> valueTreeToHierarchyMappingNodeList(juce::ValueTree hierarchyMappingValueTree)
 	{
 		std::vector<Import::HierarchyMappingNode> hierarchyMappingNodeList;
@@ -219,22 +298,249 @@ namespace AK::WwiseTransfer::ImportHelper
 		}
 	}
 
-	inline unsigned int importPreviewItemsToHash(const std::vector<Import::PreviewItem>& importItems)
+	inline std::uint64_t getPreviewItemFingerprint(const Import::PreviewItem& importItem)
 	{
-		AK::FNVHash32 hash;
+		AK::FNVHash64 hash;
+
+		auto audioFilePathRaw = importItem.audioFilePath.toUTF8();
+		hash.Compute(audioFilePathRaw, audioFilePathRaw.sizeInBytes());
+
+		auto originalsSubfolderRaw = importItem.originalsSubFolder.toUTF8();
+		hash.Compute(originalsSubfolderRaw, originalsSubfolderRaw.sizeInBytes());
+
+		hash.Compute(AK::FNVHash64::ComputeLowerCase(importItem.path.toUTF8()));
+
+		return hash.Get();
+	}
+
+	// Spreads the bits of a fingerprint so that sums of fingerprints don't cancel out
+	inline std::uint64_t mixFingerprint(std::uint64_t fingerprint)
+	{
+		fingerprint ^= fingerprint >> 30;
+		fingerprint *= 0xbf58476d1ce4e5b9ULL;
+		fingerprint ^= fingerprint >> 27;
+		fingerprint *= 0x94d049bb133111ebULL;
+		fingerprint ^= fingerprint >> 31;
+
+		return fingerprint;
+	}
+
+	// Digest of the items that does not depend on their order
+	inline std::uint64_t importPreviewItemsToHash(const std::vector<Import::PreviewItem>& importItems)
+	{
+		std::uint64_t digest = 0;
+
+		for(const auto& importItem : importItems)
+			digest += mixFingerprint(getPreviewItemFingerprint(importItem));
+
+		return digest;
+	}
+
+	// Items rendering to the same audio file. The fingerprint is the sum of their mixed fingerprints, so it does not depend on their order.
+	struct PreviewItemFingerprint
+	{
+		std::uint64_t fingerprint{0};
+		std::vector<Import::PreviewItem> items;
+	};
+
+	struct PreviewItemFingerprints
+	{
+		std::unordered_map<juce::String, PreviewItemFingerprint> byAudioFilePath;
+
+		// Same value as importPreviewItemsToHash for the items
+		std::uint64_t digest{0};
+	};
+
+	inline PreviewItemFingerprints getPreviewItemFingerprints(const std::vector<Import::PreviewItem>& importItems)
+	{
+		PreviewItemFingerprints previewItemFingerprints;
+		previewItemFingerprints.byAudioFilePath.reserve(importItems.size());
 
 		for(const auto& importItem : importItems)
 		{
-			auto audioFilePathRaw = importItem.audioFilePath.toUTF8();
-			hash.Compute(audioFilePathRaw, audioFilePathRaw.sizeInBytes());
+			const auto fingerprint = mixFingerprint(getPreviewItemFingerprint(importItem));
 
-			auto originalsSubfolderRaw = importItem.originalsSubFolder.toUTF8();
-			hash.Compute(originalsSubfolderRaw, originalsSubfolderRaw.sizeInBytes());
+			auto& previewItemFingerprint = previewItemFingerprints.byAudioFilePath[importItem.audioFilePath];
+			previewItemFingerprint.fingerprint += fingerprint;
+			previewItemFingerprint.items.push_back(importItem);
 
-			hash.Compute(AK::FNVHash32::ComputeLowerCase(importItem.path.toUTF8()));
+			previewItemFingerprints.digest += fingerprint;
 		}
 
-		return hash.Get();
+		return previewItemFingerprints;
+	}
+
+	inline Import::PreviewItemChanges getPreviewItemChanges(const PreviewItemFingerprints& previous, const PreviewItemFingerprints& current)
+	{
+		Import::PreviewItemChanges changes;
+
+		for(const auto& [audioFilePath, currentFingerprint] : current.byAudioFilePath)
+		{
+			auto it = previous.byAudioFilePath.find(audioFilePath);
+
+			if(it == previous.byAudioFilePath.end())
+			{
+				changes.added.insert(changes.added.end(), currentFingerprint.items.begin(), currentFingerprint.items.end());
+				continue;
+			}
+
+			const auto& previousFingerprint = it->second;
+
+			if(previousFingerprint.fingerprint == currentFingerprint.fingerprint)
+				continue;
+
+			// Items rendering to the same audio file are paired in order, the ones left over were added or removed
+			const auto& previousItems = previousFingerprint.items;
+			const auto& currentItems = currentFingerprint.items;
+			const auto numModified = std::min(previousItems.size(), currentItems.size());
+
+			for(std::size_t i = 0; i < numModified; ++i)
+				changes.modified.push_back({previousItems[i], currentItems[i]});
+
+			changes.added.insert(changes.added.end(), currentItems.begin() + numModified, currentItems.end());
+			changes.removed.insert(changes.removed.end(), previousItems.begin() + numModified, previousItems.end());
+		}
+
+		for(const auto& [audioFilePath, previousFingerprint] : previous.byAudioFilePath)
+		{
+			if(current.byAudioFilePath.count(audioFilePath) == 0)
+				changes.removed.insert(changes.removed.end(), previousFingerprint.items.begin(), previousFingerprint.items.end());
+		}
+
+		return changes;
+	}
+
+	// Identifies the preview row of an import item
+	struct PreviewItemRow
+	{
+		juce::String objectPath;
+		juce::String audioFilePath;
+	};
+
+	// Returns the child of parent at objectPath. Children sharing the path are told apart by their audio file when one is given.
+	inline juce::ValueTree findPreviewItemChild(const juce::ValueTree& parent, const juce::String& objectPath, const juce::String& audioFilePath = {})
+	{
+		for(const auto& child : parent)
+		{
+			if(child[IDs::objectPath].toString() == objectPath && (audioFilePath.isEmpty() || child[IDs::audioFilePath].toString() == audioFilePath))
+				return child;
+		}
+
+		return {};
+	}
+
+	// Removes the rows of items from the preview, along with the ancestors only they needed
+	inline void removePreviewItemRows(juce::ValueTree previewItems, const std::vector<PreviewItemRow>& rows)
+	{
+		for(const auto& row : rows)
+		{
+			auto node = previewItems;
+
+			for(int end = row.objectPath.indexOfChar(1, '\'); node.isValid() && end > 0; end = row.objectPath.indexOfChar(end + 1, '\'))
+				node = findPreviewItemChild(node, row.objectPath.substring(0, end));
+
+			if(!node.isValid())
+				continue;
+
+			node = findPreviewItemChild(node, row.objectPath, row.audioFilePath);
+
+			if(!node.isValid())
+				continue;
+
+			// The row is also the ancestor of other items, so it stays without its audio file
+			if(node.getNumChildren() > 0)
+			{
+				node.setProperty(IDs::audioFilePath, juce::String(), nullptr);
+				node.setProperty(IDs::wavStatus, juce::VariantConverter<Import::WavStatus>::toVar(Import::WavStatus::Unknown), nullptr);
+				continue;
+			}
+
+			for(auto parent = node.getParent(); parent != previewItems && parent.getNumChildren() == 1 && parent[IDs::audioFilePath].toString().isEmpty(); parent = node.getParent())
+				node = parent;
+
+			node.getParent().removeChild(node, nullptr);
+		}
+	}
+
+	// Adds the rows of source to the preview, updating the rows that are already in it. Unlike applyValueTreeDiff, rows missing from source are kept.
+	inline void mergePreviewItems(juce::ValueTree target, const juce::ValueTree& source)
+	{
+		for(const auto& sourceChild : source)
+		{
+			const auto objectPath = sourceChild[IDs::objectPath].toString();
+			const auto audioFilePath = sourceChild[IDs::audioFilePath].toString();
+			const auto isItem = audioFilePath.isNotEmpty();
+
+			// Like when the preview is built, items get their own row while ancestors are merged into the first row with their path
+			auto targetChild = findPreviewItemChild(target, objectPath, audioFilePath);
+
+			if(!targetChild.isValid())
+			{
+				target.appendChild(sourceChild.createCopy(), nullptr);
+				continue;
+			}
+
+			for(int i = 0; i < sourceChild.getNumProperties(); ++i)
+			{
+				auto propertyName = sourceChild.getPropertyName(i);
+
+				// Ancestors do not overwrite the audio file of an item sharing their path
+				if(!isItem && (propertyName == IDs::audioFilePath || propertyName == IDs::wavStatus))
+					continue;
+
+				const auto& value = sourceChild[propertyName];
+
+				if(targetChild[propertyName] != value)
+					targetChild.setProperty(propertyName, value, nullptr);
+			}
+
+			mergePreviewItems(targetChild, sourceChild);
+		}
+	}
+
+	namespace ImportHelperConstants
+	{
+		// Approximate number of bytes added by the json keys and punctuation surrounding a single import item
+		constexpr std::size_t importItemRequestOverhead = 96;
+	} // namespace ImportHelperConstants
+
+	inline std::size_t getImportItemRequestSize(const Waapi::ImportItemRequest& importItemRequest)
+	{
+		std::size_t size = ImportHelperConstants::importItemRequestOverhead;
+
+		size += importItemRequest.path.getNumBytesAsUTF8();
+		size += importItemRequest.originalsSubFolder.getNumBytesAsUTF8();
+
+		if(importItemRequest.renderFileWavBase64Size == 0)
+			size += importItemRequest.renderFilePath.getNumBytesAsUTF8();
+		else
+			size += importItemRequest.renderFileName.getNumBytesAsUTF8() + 1 + importItemRequest.renderFileWavBase64Size;
+
+		return size;
+	}
+
+	// Splits the import item requests into batches holding at most maxItemsPerBatch items and, unless a single item is bigger than the budget, at most maxBytesPerBatch bytes
+	inline std::vector<std::vector<Waapi::ImportItemRequest>> splitImportItemRequestsIntoBatches(std::vector<Waapi::ImportItemRequest> importItemRequests, std::size_t maxItemsPerBatch, std::size_t maxBytesPerBatch)
+	{
+		std::vector<std::vector<Waapi::ImportItemRequest>> batches;
+
+		std::size_t batchSize = 0;
+
+		for(auto& importItemRequest : importItemRequests)
+		{
+			const auto importItemRequestSize = getImportItemRequestSize(importItemRequest);
+
+			if(batches.empty() || batches.back().size() >= maxItemsPerBatch || (!batches.back().empty() && batchSize + importItemRequestSize > maxBytesPerBatch))
+			{
+				batches.emplace_back();
+				batchSize = 0;
+			}
+
+			batches.back().emplace_back(std::move(importItemRequest));
+			batchSize += importItemRequestSize;
+		}
+
+		return batches;
 	}
 
 	inline juce::String createImportSummary(const juce::String& applicationName, juce::Time currentTime, const Import::Summary& summary, const Import::Task::Options& importTaskOptions)
@@ -255,6 +561,9 @@ namespace AK::WwiseTransfer::ImportHelper
 		report << "Object Templates Applied: " + juce::String(summary.getNumObjectTemplatesApplied()) + "<br>";
 		report << "Audio Files Imported: " + juce::String(summary.getNumAudiofilesTransfered()) + "<br>";
 
+		if(summary.cancelled)
+			report << "<br>Wwise Import was cancelled, <a href='#not-imported-files'>" + juce::String(summary.notImportedFiles.size()) + " audio file(s)</a> were not imported.<br>";
+
 		if(hasErrors)
 			report << "<br>Wwise Imported with <a href='#waapi-errors'>Errors!</a><br>";
 
@@ -270,6 +579,17 @@ namespace AK::WwiseTransfer::ImportHelper
 
 		report << "</table></pre>";
 
+		if(summary.cancelled && !summary.notImportedFiles.empty())
+		{
+			report << "<h3 id='not-imported-files'>Audio Files Not Imported</h3>";
+			report << "<pre><table><tr><th>Render File</th></tr>";
+
+			for(const auto& notImportedFile : summary.notImportedFiles)
+				report << "<tr><td>" + notImportedFile + "</td></tr>";
+
+			report << "</table></pre>";
+		}
+
 		if(hasErrors)
 		{
 			report << "<h3 id='waapi-errors'>WAAPI Errors</h3>";
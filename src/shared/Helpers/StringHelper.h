@@ -16,6 +16,7 @@ specific language governing permissions and limitations under the License.
 #pragma once
 
 #include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <iterator>
 #include <juce_gui_basics/juce_gui_basics.h>
@@ -30,27 +31,30 @@ namespace AK::WwiseTransfer::StringHelper
 		return {juce::CharPointer_UTF8(&charArray[0]), std::size(charArray)};
 	}
 
-	inline std::vector<juce::String> splitDoubleNullTerminatedString(const std::vector<char>& buffer)
+	// Strings are created straight from the buffer. A trailing string missing its null terminator is ignored.
+	inline std::vector<juce::String> splitDoubleNullTerminatedString(const char* buffer, std::size_t bufferSize)
 	{
 		std::vector<juce::String> stringArray;
 
-		std::vector<char> tempBuffer;
-		for(const char character : buffer)
+		const char* end = buffer + bufferSize;
+		for(const char* start = buffer; start < end && *start != '\0';)
 		{
-			if(character != '\0')
-				tempBuffer.push_back(character);
-			else if(!tempBuffer.empty())
-			{
-				stringArray.push_back(utf8EncodedCharArrayToString(tempBuffer));
-				tempBuffer.clear();
-			}
-			else
+			const auto* terminator = static_cast<const char*>(std::memchr(start, '\0', static_cast<std::size_t>(end - start)));
+			if(terminator == nullptr)
 				break;
+
+			stringArray.emplace_back(juce::CharPointer_UTF8(start), juce::CharPointer_UTF8(terminator));
+			start = terminator + 1;
 		}
 
 		return stringArray;
 	}
 
+	inline std::vector<juce::String> splitDoubleNullTerminatedString(const std::vector<char>& buffer)
+	{
+		return splitDoubleNullTerminatedString(buffer.data(), buffer.size());
+	}
+
 	inline std::vector<char> createDoubleNullTerminatedStringBuffer(const std::vector<juce::String>& strings)
 	{
 		std::vector<char> rv;
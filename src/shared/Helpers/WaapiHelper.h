@@ -18,10 +18,262 @@ specific language governing permissions and limitations under the License.
 #include "Model/Waapi.h"
 
 #include <JSONHelpers.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
 #include <juce_core/juce_core.h>
+#include <string>
+#include <string_view>
 
 namespace AK::WwiseTransfer::WaapiHelper
 {
+	namespace WaapiHelperConstants
+	{
+		constexpr std::size_t maxLogStringLength = 10'000;
+
+		// Waits between attempts are sliced so that cancellation is noticed quickly
+		constexpr int retryWaitSliceMs = 10;
+
+		// Wwise refuses calls while a modal dialog is open, it will accept them again once closed
+		constexpr const char* const lockedErrorUri = "ak.wwise.locked";
+
+		constexpr int noDeadline = 0;
+
+		// Calls that Wwise answers quickly regardless of the project size
+		constexpr int lightCallDeadlineMs = 10'000;
+
+		// Queries over a hierarchy and imports take longer the more objects they cover. They get a base budget plus a share per object, up to a maximum.
+		constexpr int heavyCallBaseDeadlineMs = 60'000;
+		constexpr int heavyCallDeadlineMsPerObject = 50;
+		constexpr int maxHeavyCallDeadlineMs = 30 * 60'000;
+	} // namespace WaapiHelperConstants
+
+	inline int getHeavyCallDeadlineMs(std::size_t numObjects)
+	{
+		using namespace WaapiHelperConstants;
+
+		const auto maxNumObjects = static_cast<std::size_t>((maxHeavyCallDeadlineMs - heavyCallBaseDeadlineMs) / heavyCallDeadlineMsPerObject);
+
+		return heavyCallBaseDeadlineMs + static_cast<int>(std::min(numObjects, maxNumObjects)) * heavyCallDeadlineMsPerObject;
+	}
+
+	struct RetryPolicy
+	{
+		int initialDelayMs{100};
+		int maxDelayMs{2000};
+		double backoffMultiplier{2.0};
+
+		// Each delay is randomly moved by up to this fraction of itself so that jobs failing together do not retry together
+		double jitter{0.2};
+
+		int maxAttempts{20};
+
+		// Total time allowed for all attempts and waits. Calls made within the budget are given the remaining time as timeout.
+		int deadlineMs{WaapiHelperConstants::heavyCallBaseDeadlineMs};
+	};
+
+	inline RetryPolicy createRetryPolicy(int deadlineMs)
+	{
+		RetryPolicy retryPolicy;
+		retryPolicy.deadlineMs = deadlineMs;
+
+		return retryPolicy;
+	}
+
+	enum class AttemptStatus
+	{
+		Succeeded,
+		TransientFailure,
+		PermanentFailure
+	};
+
+	class CancellationToken
+	{
+	public:
+		void cancel()
+		{
+			cancelled = true;
+		}
+
+		bool isCancelled() const
+		{
+			return cancelled;
+		}
+
+	private:
+		std::atomic<bool> cancelled{false};
+	};
+
+	// Deadline of the waapi calls made by the current thread, in juce::Time::getMillisecondCounter() time. Zero when there is none.
+	inline thread_local juce::uint32 callDeadlineMs = 0;
+
+	class ScopedCallDeadline
+	{
+	public:
+		explicit ScopedCallDeadline(juce::uint32 deadlineMs)
+			: previousDeadlineMs(callDeadlineMs)
+		{
+			callDeadlineMs = deadlineMs;
+		}
+
+		~ScopedCallDeadline()
+		{
+			callDeadlineMs = previousDeadlineMs;
+		}
+
+	private:
+		juce::uint32 previousDeadlineMs;
+	};
+
+	inline juce::uint32 getDeadlineFromNow(int durationMs)
+	{
+		return juce::Time::getMillisecondCounter() + static_cast<juce::uint32>(durationMs);
+	}
+
+	// Bounds calls that would otherwise wait forever by the deadline of the current thread
+	inline int getCallTimeoutMs(int timeoutMs)
+	{
+		if(timeoutMs >= 0 || callDeadlineMs == 0)
+			return timeoutMs;
+
+		const auto remainingMs = static_cast<int>(callDeadlineMs - juce::Time::getMillisecondCounter());
+
+		return juce::jmax(1, remainingMs);
+	}
+
+	// Failures without an error uri come from the connection (not connected, timed out), they may succeed later.
+	// Errors reported by Wwise are deterministic, except when Wwise is temporarily locked.
+	inline bool isTransientError(const Waapi::Error& error)
+	{
+		return error.uri.isEmpty() || error.uri == WaapiHelperConstants::lockedErrorUri;
+	}
+
+	// Delay before the given retry (1 for the first one), without jitter
+	inline int getRetryDelayMs(const RetryPolicy& policy, int retry)
+	{
+		const auto delayMs = policy.initialDelayMs * std::pow(policy.backoffMultiplier, retry - 1);
+
+		return static_cast<int>(juce::jmin(static_cast<double>(policy.maxDelayMs), delayMs));
+	}
+
+	struct JsonSize
+	{
+		std::size_t items{0};
+		std::size_t bytes{0};
+	};
+
+	// Roughly estimates the serialized size of the json without serializing it. Items are the elements of all arrays.
+	inline void accumulateJsonSize(const WwiseAuthoringAPI::AkJson& json, JsonSize& size)
+	{
+		if(json.IsMap())
+		{
+			for(const auto& [key, value] : json.GetMap())
+			{
+				size.bytes += key.size() + 4;
+				accumulateJsonSize(value, size);
+			}
+		}
+		else if(json.IsArray())
+		{
+			for(const auto& value : json.GetArray())
+			{
+				++size.items;
+				size.bytes += 1;
+				accumulateJsonSize(value, size);
+			}
+		}
+		else if(json.IsVariant() && json.GetVariant().IsString())
+			size.bytes += json.GetVariant().GetString().size() + 2;
+		else
+			size.bytes += 8;
+	}
+
+	inline JsonSize estimateJsonSize(const WwiseAuthoringAPI::AkJson& json)
+	{
+		JsonSize size;
+		accumulateJsonSize(json, size);
+
+		return size;
+	}
+
+	// Serializes the json into output, stopping as soon as maxLength characters are reached so that large payloads are never serialized in full
+	inline void appendToLogString(std::string& output, const WwiseAuthoringAPI::AkJson& json, std::size_t maxLength)
+	{
+		if(output.size() >= maxLength)
+			return;
+
+		if(json.IsMap())
+		{
+			output += '{';
+
+			for(const auto& [key, value] : json.GetMap())
+			{
+				if(output.size() >= maxLength)
+					return;
+
+				if(output.back() != '{')
+					output += ',';
+
+				output.append("\"").append(key).append("\":");
+				appendToLogString(output, value, maxLength);
+			}
+
+			output += '}';
+		}
+		else if(json.IsArray())
+		{
+			output += '[';
+
+			for(const auto& value : json.GetArray())
+			{
+				if(output.size() >= maxLength)
+					return;
+
+				if(output.back() != '[')
+					output += ',';
+
+				appendToLogString(output, value, maxLength);
+			}
+
+			output += ']';
+		}
+		else if(json.IsVariant() && json.GetVariant().IsString())
+		{
+			const auto& value = json.GetVariant().GetString();
+
+			output += '"';
+			output.append(value, 0, std::min(value.size(), maxLength - output.size()));
+			output += '"';
+		}
+		else
+			output += WwiseAuthoringAPI::JSONHelpers::GetAkJsonString(json);
+	}
+
+	// Serializes the json for logging. Truncated payloads are summarized by their size and item count.
+	inline juce::String toLogString(const WwiseAuthoringAPI::AkJson& json, std::size_t maxLength = WaapiHelperConstants::maxLogStringLength)
+	{
+		std::string output;
+		appendToLogString(output, json, maxLength);
+
+		if(output.size() < maxLength)
+			return output;
+
+		const auto size = estimateJsonSize(json);
+
+		return juce::String(output.substr(0, maxLength)) + "... (truncated, " + juce::String(size.items) + " items, ~" +
+		       juce::File::descriptionOfSizeInBytes(static_cast<juce::int64>(size.bytes)) + ")";
+	}
+
+	inline juce::String toLogString(std::string_view json, std::size_t maxLength = WaapiHelperConstants::maxLogStringLength)
+	{
+		if(json.size() <= maxLength)
+			return juce::String(json.data(), json.size());
+
+		return juce::String(json.data(), maxLength) + "... (truncated, " +
+		       juce::File::descriptionOfSizeInBytes(static_cast<juce::int64>(json.size())) + ")";
+	}
+
 	template <class Function>
 	inline void executeWithRetry(Function function, int retryDelayMs = 500, int maxAttempts = 20)
 	{
@@ -29,6 +281,57 @@ namespace AK::WwiseTransfer::WaapiHelper
 			juce::Time::waitForMillisecondCounter(juce::Time::getMillisecondCounter() + retryDelayMs);
 	}
 
+	// Calls function until it succeeds, fails permanently, runs out of attempts or time, or shouldStop returns true.
+	// Returns whether the function succeeded.
+	template <class Function, class ShouldStop>
+	inline bool executeWithRetry(Function function, const RetryPolicy& policy, ShouldStop shouldStop)
+	{
+		thread_local juce::Random random;
+
+		const auto hasDeadline = policy.deadlineMs != WaapiHelperConstants::noDeadline;
+		const auto deadlineMs = juce::Time::getMillisecondCounter() + static_cast<juce::uint32>(policy.deadlineMs);
+
+		// Without a deadline, calls keep the timeout they were made with
+		const ScopedCallDeadline scopedCallDeadline(hasDeadline ? deadlineMs : callDeadlineMs);
+
+		auto remainingMs = [hasDeadline, deadlineMs]()
+		{
+			if(!hasDeadline)
+				return std::numeric_limits<int>::max();
+
+			return static_cast<int>(deadlineMs - juce::Time::getMillisecondCounter());
+		};
+
+		for(int attempt = 1;; ++attempt)
+		{
+			const auto status = function();
+
+			if(status == AttemptStatus::Succeeded)
+				return true;
+
+			if(status == AttemptStatus::PermanentFailure || attempt >= policy.maxAttempts || shouldStop())
+				return false;
+
+			const auto delayMs = getRetryDelayMs(policy, attempt);
+			const auto jitterMs = static_cast<int>(delayMs * policy.jitter * (2.0 * random.nextDouble() - 1.0));
+			const auto waitMs = juce::jmax(0, delayMs + jitterMs);
+
+			// Don't wait for an attempt that would start past the deadline
+			if(waitMs >= remainingMs())
+				return false;
+
+			const auto waitEndMs = juce::Time::getMillisecondCounter() + static_cast<juce::uint32>(waitMs);
+
+			while(static_cast<int>(waitEndMs - juce::Time::getMillisecondCounter()) > 0)
+			{
+				if(shouldStop())
+					return false;
+
+				juce::Thread::sleep(juce::jmin(WaapiHelperConstants::retryWaitSliceMs, static_cast<int>(waitEndMs - juce::Time::getMillisecondCounter())));
+			}
+		}
+	}
+
 	inline Waapi::Error parseError(const juce::String& procedureUri, AK::WwiseAuthoringAPI::AkJson result)
 	{
 		Waapi::Error error;
@@ -15,11 +15,11 @@ specific language governing permissions and limitations under the License.
 
 #pragma once
 
+#include "Helpers/WwisePath.h"
 #include "Model/IDs.h"
 #include "Model/Wwise.h"
 
 #include <juce_gui_basics/juce_gui_basics.h>
-#include <regex>
 
 namespace AK::WwiseTransfer::WwiseHelper
 {
@@ -114,36 +114,7 @@ namespace AK::WwiseTransfer::WwiseHelper
 
 	inline Wwise::ObjectType stringToObjectType(const juce::String& objectTypeAsString)
 	{
-		using namespace Wwise;
-
-		if(objectTypeAsString == "AudioFileSource" || objectTypeAsString == "Audio File Source")
-			return ObjectType::AudioFileSource;
-		else if(objectTypeAsString == "ActorMixer" || objectTypeAsString == "Actor Mixer" || objectTypeAsString == "Actor-Mixer" || objectTypeAsString == "Property Container" || objectTypeAsString == "Actor-Mixer / Property Container")
-			return ObjectType::ActorMixer;
-		else if(objectTypeAsString == "BlendContainer" || objectTypeAsString == "Blend Container")
-			return ObjectType::BlendContainer;
-		else if(objectTypeAsString == "Folder")
-			return ObjectType::VirtualFolder;
-		else if(objectTypeAsString == "RandomSequenceContainer" || objectTypeAsString == "Random Container")
-			return ObjectType::RandomContainer;
-		else if(objectTypeAsString == "SequenceContainer" || objectTypeAsString == "Sequence Container")
-			return ObjectType::SequenceContainer;
-		else if(objectTypeAsString == "Sound")
-			return ObjectType::Sound;
-		else if(objectTypeAsString == "SoundSFX" || objectTypeAsString == "Sound SFX")
-			return ObjectType::SoundSFX;
-		else if(objectTypeAsString == "Sound Voice")
-			return ObjectType::SoundVoice;
-		else if(objectTypeAsString == "SwitchContainer" || objectTypeAsString == "Switch Container")
-			return ObjectType::SwitchContainer;
-		else if(objectTypeAsString == "WorkUnit" || objectTypeAsString == "Work Unit")
-			return ObjectType::WorkUnit;
-		else if(objectTypeAsString == "Virtual Folder")
-			return ObjectType::VirtualFolder;
-		else if(objectTypeAsString == "Physical Folder")
-			return ObjectType::PhysicalFolder;
-		else
-			return ObjectType::Unknown;
+		return WwisePath::toObjectType(WwisePath::toStringView(objectTypeAsString));
 	};
 
 	inline juce::String buildObjectPathNode(Wwise::ObjectType objectType, const juce::String& name)
@@ -153,61 +124,52 @@ namespace AK::WwiseTransfer::WwiseHelper
 
 	inline juce::String pathToPathWithoutObjectTypes(const juce::String& objectPath)
 	{
-		static std::regex pattern("<.+?>");
-		auto result = std::regex_replace(objectPath.toStdString(), pattern, "");
-		return juce::String(result);
+		if(!objectPath.containsChar('<'))
+			return objectPath;
+
+		return WwisePath::toStringWithoutObjectTypes(WwisePath::toStringView(objectPath));
 	}
 
 	inline std::vector<juce::String> pathToPathParts(const juce::String& objectPath)
 	{
-		juce::StringArray parts;
-		parts.addTokens(objectPath.trimCharactersAtStart("\\"), "\\", "");
-
 		std::vector<juce::String> objectPathParts;
-		for(auto& part : parts)
-		{
-			objectPathParts.emplace_back(part);
-		}
+
+		WwisePath::Tokenizer tokenizer(WwisePath::toStringView(objectPath));
+
+		for(std::string_view part; tokenizer.next(part);)
+			objectPathParts.emplace_back(WwisePath::toString(part));
 
 		return objectPathParts;
 	}
 
+	// Number of parts pathToPathParts would return, without building them
+	inline int getPathDepth(const juce::String& objectPath)
+	{
+		return static_cast<int>(WwisePath::countParts(WwisePath::toStringView(objectPath)));
+	}
+
 	inline std::vector<juce::String> pathToAncestorPaths(const juce::String& objectPath)
 	{
 		std::vector<juce::String> ancestors;
 
-		auto parts = pathToPathParts(objectPath);
-
-		juce::String current;
-		for(int i = 0; i < parts.size() - 1; ++i)
+		auto onAncestor = [&ancestors](std::string_view ancestorPath)
 		{
-			current << "\\" << parts[i];
-			ancestors.emplace_back(current);
-		}
+			ancestors.emplace_back(WwisePath::toRootedString(ancestorPath));
+		};
+
+		WwisePath::forEachAncestor(WwisePath::toStringView(objectPath), onAncestor);
 
 		return ancestors;
 	}
 
 	inline juce::String pathToObjectName(const juce::String& objectPath)
 	{
-		auto lastIndexGreaterThan = objectPath.lastIndexOf(">");
-		auto lastIndexOfPathSeperator = objectPath.lastIndexOf("\\");
-
-		if(lastIndexGreaterThan > lastIndexOfPathSeperator)
-			return objectPath.substring(lastIndexGreaterThan + 1);
-		else
-			return objectPath.substring(lastIndexOfPathSeperator + 1);
+		return WwisePath::toString(WwisePath::getObjectName(WwisePath::toStringView(objectPath)));
 	}
 
 	inline Wwise::ObjectType pathToObjectType(const juce::String& objectPath)
 	{
-		if(objectPath == "\\Actor-Mixer Hierarchy" || objectPath == "\\Containers")
-			return Wwise::ObjectType::ActorMixer;
-
-		auto lastIndexLessThan = objectPath.lastIndexOf("<");
-		auto lastIndexGreaterThan = objectPath.lastIndexOf(">");
-
-		return WwiseHelper::stringToObjectType(objectPath.substring(lastIndexLessThan + 1, lastIndexGreaterThan));
+		return WwisePath::getObjectType(WwisePath::toStringView(objectPath));
 	}
 
 	inline juce::ValueTree versionToValueTree(const Wwise::Version& version)
@@ -261,17 +223,13 @@ namespace AK::WwiseTransfer::WwiseHelper
 
 	inline juce::String getCommonAncestor(const juce::String& firstPath, const juce::String& secondPath)
 	{
-		auto firstAsParts = WwiseHelper::pathToPathParts(firstPath);
-		auto lastAsParts = WwiseHelper::pathToPathParts(secondPath);
+		WwisePath::Tokenizer firstTokenizer(WwisePath::toStringView(firstPath));
+		WwisePath::Tokenizer secondTokenizer(WwisePath::toStringView(secondPath));
 
 		juce::String commonAncestorPath;
-		for(int i = 0; i < firstAsParts.size() && i < lastAsParts.size(); ++i)
-		{
-			if(firstAsParts[i] == lastAsParts[i])
-				commonAncestorPath << "\\" << firstAsParts[i];
-			else
-				break;
-		}
+
+		for(std::string_view firstPart, secondPart; firstTokenizer.next(firstPart) && secondTokenizer.next(secondPart) && firstPart == secondPart;)
+			commonAncestorPath << "\\" << WwisePath::toString(firstPart);
 
 		return commonAncestorPath;
 	}
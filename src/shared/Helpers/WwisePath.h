@@ -0,0 +1,317 @@
+/*----------------------------------------------------------------------------------------
+
+Copyright (c) 2025 AUDIOKINETIC Inc.
+
+This file is licensed to use under the license available at:
+https://github.com/audiokinetic/ReaWwise/blob/main/License.txt (the "License").
+You may not use this file except in compliance with the License.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations under the License.
+
+----------------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "Model/Wwise.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <juce_core/juce_core.h>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+// Allocation free parsing of Wwise object paths such as "\Actor-Mixer Hierarchy\<Work Unit>Default Work Unit\<Sound SFX>Footstep".
+// Everything works on views of the original UTF-8 text, separators and object type delimiters being ASCII.
+namespace AK::WwiseTransfer::WwisePath
+{
+	constexpr char separator = '\\';
+
+	// The view stays valid as long as the string is alive and unmodified
+	inline std::string_view toStringView(const juce::String& text)
+	{
+		return {text.toRawUTF8(), text.getNumBytesAsUTF8()};
+	}
+
+	inline juce::String toString(std::string_view text)
+	{
+		return juce::String::fromUTF8(text.data(), static_cast<int>(text.size()));
+	}
+
+	// Object paths are absolute. Paths written without their leading separator are given one.
+	inline juce::String toRootedString(std::string_view path)
+	{
+		if(!path.empty() && path.front() == separator)
+			return toString(path);
+
+		return juce::String::charToString(separator) + toString(path);
+	}
+
+	// Offset of the first part of the path, after the leading separators
+	inline std::size_t getFirstPartOffset(std::string_view path)
+	{
+		const auto offset = path.find_first_not_of(separator);
+		return offset == std::string_view::npos ? path.size() : offset;
+	}
+
+	// Splits a path into its parts, ignoring the leading separators: "\A\<Type>B" yields "A" then "<Type>B".
+	// Consecutive or trailing separators yield empty parts.
+	class Tokenizer
+	{
+	public:
+		explicit Tokenizer(std::string_view path)
+			: remaining(path.substr(getFirstPartOffset(path)))
+			, done(remaining.empty())
+		{
+		}
+
+		// Returns false once every part was returned
+		bool next(std::string_view& part)
+		{
+			if(done)
+				return false;
+
+			const auto end = remaining.find(separator);
+			part = remaining.substr(0, end);
+
+			if(end == std::string_view::npos)
+				done = true;
+			else
+				remaining.remove_prefix(end + 1);
+
+			return true;
+		}
+
+	private:
+		std::string_view remaining;
+		bool done;
+	};
+
+	inline std::size_t countParts(std::string_view path)
+	{
+		const auto parts = path.substr(getFirstPartOffset(path));
+
+		if(parts.empty())
+			return 0;
+
+		return 1 + static_cast<std::size_t>(std::count(parts.begin(), parts.end(), separator));
+	}
+
+	// Calls function with the path of every ancestor, from the top level: "\A\B\C" yields "\A" then "\A\B".
+	// Ancestor paths are views of the path starting at its last leading separator, if any.
+	template <typename Function>
+	inline void forEachAncestor(std::string_view path, Function function)
+	{
+		const auto firstPartOffset = getFirstPartOffset(path);
+		const auto rootOffset = firstPartOffset > 0 ? firstPartOffset - 1 : 0;
+
+		for(auto end = path.find(separator, firstPartOffset); end != std::string_view::npos; end = path.find(separator, end + 1))
+			function(path.substr(rootOffset, end - rootOffset));
+	}
+
+	// Part of the path that follows its last separator, without its object type
+	inline std::string_view getObjectName(std::string_view path)
+	{
+		const auto lastGreaterThan = path.rfind('>');
+		const auto lastSeparator = path.rfind(separator);
+
+		if(lastGreaterThan != std::string_view::npos && (lastSeparator == std::string_view::npos || lastGreaterThan > lastSeparator))
+			return path.substr(lastGreaterThan + 1);
+
+		return lastSeparator == std::string_view::npos ? path : path.substr(lastSeparator + 1);
+	}
+
+	// Text between the last '<' and the last '>' of the path, or an empty view
+	inline std::string_view getObjectTypeName(std::string_view path)
+	{
+		const auto lastLessThan = path.rfind('<');
+		const auto lastGreaterThan = path.rfind('>');
+		const auto start = lastLessThan == std::string_view::npos ? 0 : lastLessThan + 1;
+
+		if(lastGreaterThan == std::string_view::npos || lastGreaterThan <= start)
+			return {};
+
+		return path.substr(start, lastGreaterThan - start);
+	}
+
+	inline Wwise::ObjectType toObjectType(std::string_view objectTypeName)
+	{
+		using namespace Wwise;
+
+		if(objectTypeName == "AudioFileSource" || objectTypeName == "Audio File Source")
+			return ObjectType::AudioFileSource;
+		else if(objectTypeName == "ActorMixer" || objectTypeName == "Actor Mixer" || objectTypeName == "Actor-Mixer" || objectTypeName == "Property Container" || objectTypeName == "Actor-Mixer / Property Container")
+			return ObjectType::ActorMixer;
+		else if(objectTypeName == "BlendContainer" || objectTypeName == "Blend Container")
+			return ObjectType::BlendContainer;
+		else if(objectTypeName == "Folder")
+			return ObjectType::VirtualFolder;
+		else if(objectTypeName == "RandomSequenceContainer" || objectTypeName == "Random Container")
+			return ObjectType::RandomContainer;
+		else if(objectTypeName == "SequenceContainer" || objectTypeName == "Sequence Container")
+			return ObjectType::SequenceContainer;
+		else if(objectTypeName == "Sound")
+			return ObjectType::Sound;
+		else if(objectTypeName == "SoundSFX" || objectTypeName == "Sound SFX")
+			return ObjectType::SoundSFX;
+		else if(objectTypeName == "Sound Voice")
+			return ObjectType::SoundVoice;
+		else if(objectTypeName == "SwitchContainer" || objectTypeName == "Switch Container")
+			return ObjectType::SwitchContainer;
+		else if(objectTypeName == "WorkUnit" || objectTypeName == "Work Unit")
+			return ObjectType::WorkUnit;
+		else if(objectTypeName == "Virtual Folder")
+			return ObjectType::VirtualFolder;
+		else if(objectTypeName == "Physical Folder")
+			return ObjectType::PhysicalFolder;
+		else
+			return ObjectType::Unknown;
+	}
+
+	inline Wwise::ObjectType getObjectType(std::string_view path)
+	{
+		if(path == "\\Actor-Mixer Hierarchy" || path == "\\Containers")
+			return Wwise::ObjectType::ActorMixer;
+
+		return toObjectType(getObjectTypeName(path));
+	}
+
+	// Copies the path to output without the object types ("<...>") and returns the number of bytes written.
+	// Output must be able to hold path.size() bytes.
+	inline std::size_t removeObjectTypes(std::string_view path, char* output)
+	{
+		std::size_t length = 0;
+
+		for(std::size_t i = 0; i < path.size();)
+		{
+			// An object type holds at least one character
+			if(path[i] == '<')
+			{
+				const auto end = path.find('>', i + 2);
+
+				if(end != std::string_view::npos)
+				{
+					i = end + 1;
+					continue;
+				}
+			}
+
+			output[length++] = path[i++];
+		}
+
+		return length;
+	}
+
+	// Same as removeObjectTypes, returning the result as a string. Short paths don't need a temporary heap buffer.
+	inline juce::String toStringWithoutObjectTypes(std::string_view path)
+	{
+		if(path.find('<') == std::string_view::npos)
+			return toString(path);
+
+		constexpr std::size_t stackBufferSize = 1024;
+		std::array<char, stackBufferSize> stackBuffer;
+		std::unique_ptr<char[]> heapBuffer;
+
+		auto* buffer = stackBuffer.data();
+
+		if(path.size() > stackBufferSize)
+		{
+			heapBuffer = std::make_unique<char[]>(path.size());
+			buffer = heapBuffer.get();
+		}
+
+		return toString({buffer, removeObjectTypes(path, buffer)});
+	}
+
+	// Path split into parts once, giving constant time access to each part, its name and its object type
+	class ParsedPath
+	{
+	public:
+		explicit ParsedPath(std::string_view path)
+			: path(path)
+		{
+			Tokenizer tokenizer(path);
+
+			for(std::string_view part; tokenizer.next(part);)
+			{
+				const auto offset = static_cast<std::uint32_t>(part.data() - path.data());
+				const auto typeEnd = part.size() > 0 && part.front() == '<' ? part.find('>') : std::string_view::npos;
+
+				Part parsedPart{offset, static_cast<std::uint32_t>(part.size()), typeEnd == std::string_view::npos ? 0 : static_cast<std::uint32_t>(typeEnd + 1)};
+
+				if(count < inlineCapacity)
+					inlineParts[count] = parsedPart;
+				else
+					overflowParts.push_back(parsedPart);
+
+				++count;
+			}
+		}
+
+		std::size_t size() const
+		{
+			return count;
+		}
+
+		std::string_view getPath() const
+		{
+			return path;
+		}
+
+		// Part as written in the path, e.g. "<Sound SFX>Footstep"
+		std::string_view getPart(std::size_t index) const
+		{
+			const auto& part = getParsedPart(index);
+			return path.substr(part.offset, part.length);
+		}
+
+		std::string_view getName(std::size_t index) const
+		{
+			const auto& part = getParsedPart(index);
+			return path.substr(part.offset + part.typeLength, part.length - part.typeLength);
+		}
+
+		// Object type of the part without its delimiters, or an empty view if the part has no object type
+		std::string_view getTypeName(std::size_t index) const
+		{
+			const auto& part = getParsedPart(index);
+			return part.typeLength < 2 ? std::string_view() : path.substr(part.offset + 1, part.typeLength - 2);
+		}
+
+		// Path of the object the part refers to, e.g. index 0 gives "\Actor-Mixer Hierarchy"
+		std::string_view getAncestorOrSelf(std::size_t index) const
+		{
+			const auto& firstPart = getParsedPart(0);
+			const auto& part = getParsedPart(index);
+			const auto rootOffset = firstPart.offset > 0 ? firstPart.offset - 1 : 0;
+
+			return path.substr(rootOffset, part.offset + part.length - rootOffset);
+		}
+
+	private:
+		// Deeper paths are rare, their remaining parts are stored on the heap
+		static constexpr std::size_t inlineCapacity = 32;
+
+		struct Part
+		{
+			std::uint32_t offset;
+			std::uint32_t length;
+			std::uint32_t typeLength;
+		};
+
+		const Part& getParsedPart(std::size_t index) const
+		{
+			jassert(index < count);
+			return index < inlineCapacity ? inlineParts[index] : overflowParts[index - inlineCapacity];
+		}
+
+		std::string_view path;
+		std::array<Part, inlineCapacity> inlineParts{};
+		std::vector<Part> overflowParts;
+		std::size_t count{0};
+	};
+} // namespace AK::WwiseTransfer::WwisePath
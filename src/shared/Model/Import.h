@@ -68,10 +68,34 @@ namespace AK::WwiseTransfer::Import
 	struct Item : public PreviewItem
 	{
 		juce::String renderFilePath;
-		juce::String renderFileWavBase64;
 		juce::String renderFileName;
 	};
 
+	// An item whose fingerprint changed between two lists of preview items rendering to the same audio file
+	struct ModifiedPreviewItem
+	{
+		PreviewItem previous;
+		PreviewItem current;
+	};
+
+	// Items that differ between two lists of preview items, matched by audio file path
+	struct PreviewItemChanges
+	{
+		std::vector<PreviewItem> added;
+		std::vector<PreviewItem> removed;
+		std::vector<ModifiedPreviewItem> modified;
+
+		bool isEmpty() const
+		{
+			return added.empty() && removed.empty() && modified.empty();
+		}
+
+		std::size_t size() const
+		{
+			return added.size() + removed.size() + modified.size();
+		}
+	};
+
 	struct PreviewItemNode
 	{
 		juce::String name;
@@ -152,6 +176,10 @@ namespace AK::WwiseTransfer::Import
 		std::map<juce::String, Object> objects;
 		std::vector<AK::WwiseTransfer::Waapi::Error> errors;
 
+		// Set when the import was cancelled, the batches imported before that are kept
+		bool cancelled{false};
+		std::vector<juce::String> notImportedFiles;
+
 		using PathObjectPair = std::pair<juce::String, Object>;
 
 		int getNumAudiofilesTransfered() const
@@ -197,6 +225,7 @@ namespace AK::WwiseTransfer::Import
 			bool applyTemplateFeatureEnabled{false};
 			bool undoGroupFeatureEnabled{false};
 			bool waqlEnabled{false};
+			bool crossMachineTransferEnabled{false};
 		};
 	} // namespace Task
 } // namespace AK::WwiseTransfer::Import
@@ -21,16 +21,27 @@ specific language governing permissions and limitations under the License.
 
 #include <juce_gui_basics/juce_gui_basics.h>
 #include <set>
+#include <string>
 
 namespace AK::WwiseTransfer::Waapi
 {
+	enum class LogLevel
+	{
+		Off,
+		Info,
+		Debug
+	};
+
 	struct ImportItemRequest
 	{
 		juce::String path;
 		juce::String originalsSubFolder;
 		juce::String renderFilePath;
-		juce::String renderFileWavBase64;
 		juce::String renderFileName;
+
+		// Only set for cross machine transfers. The payload is encoded right before its batch is sent and freed right after.
+		std::size_t renderFileWavBase64Size{0};
+		std::string renderFileWavBase64;
 	};
 
 	struct ProjectInfo
@@ -40,6 +40,10 @@ namespace AK::WwiseTransfer
 
 		const juce::String enableCrossMachineTransferName = "enableCrossMachineTransfer";
 		constexpr bool enableCrossMachineTransferValue = false;
+
+		// One of "off", "info" or "debug". Debug logs the content of every waapi call.
+		const juce::String waapiLogLevelName = "waapiLogLevel";
+		const juce::String waapiLogLevelValue = "info";
 	} // namespace ApplicationPropertyConstants
 
 	ApplicationProperties::ApplicationProperties(const juce::String& applicationName)
@@ -174,4 +178,15 @@ namespace AK::WwiseTransfer
 		using namespace ApplicationPropertyConstants;
 		getUserSettings()->setValue(enableCrossMachineTransferName, value);
 	}
+
+	Waapi::LogLevel ApplicationProperties::getWaapiLogLevel()
+	{
+		using namespace ApplicationPropertyConstants;
+		auto val = getUserSettings()->getValue(waapiLogLevelName, waapiLogLevelValue).trim().toLowerCase();
+		if(val == "off")
+			return Waapi::LogLevel::Off;
+		if(val == "debug")
+			return Waapi::LogLevel::Debug;
+		return Waapi::LogLevel::Info;
+	}
 } // namespace AK::WwiseTransfer
@@ -15,6 +15,8 @@ specific language governing permissions and limitations under the License.
 
 #pragma once
 
+#include "Model/Waapi.h"
+
 #include <juce_data_structures/juce_data_structures.h>
 
 namespace AK::WwiseTransfer
@@ -38,6 +40,7 @@ namespace AK::WwiseTransfer
 		void setShowSilentIncrementWarning(bool value);
 		bool getIsCrossMachineTransferEnabled();
 		void setIsCrossMachineTransferEnabled(bool value);
+		Waapi::LogLevel getWaapiLogLevel();
 
 	private:
 		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ApplicationProperties)
@@ -15,12 +15,13 @@ specific language governing permissions and limitations under the License.
 
 #include "ImportControlsComponent.h"
 
+#include "Core/DirectoryListingCache.h"
 #include "Helpers/FileHelper.h"
 #include "Helpers/ImportHelper.h"
 #include "Model/IDs.h"
 #include "Theme/CustomLookAndFeel.h"
 
-#include <set>
+#include <algorithm>
 
 namespace AK::WwiseTransfer
 {
@@ -39,6 +40,8 @@ namespace AK::WwiseTransfer
 		constexpr int errorMessageWidth = 260;
 		constexpr int errorMessageHeight = 200;
 		constexpr int errorMessageMarginLeft = 75;
+
+		constexpr std::size_t maxFailedRenderTargetsShown = 10;
 	}; // namespace ImportControlsComponentConstants
 
 	ImportControlsComponent::ImportControlsComponent(juce::ValueTree appState,
@@ -128,60 +131,62 @@ namespace AK::WwiseTransfer
 
 		const auto previewItems = dawContext.getItemsForPreview(opts);
 
-		// Confirm that files where rendered
-		std::set<juce::File> directorySet;
-		for(const auto item : previewItems)
+		if(canImportWhileRendering(previewItems))
 		{
-			directorySet.insert(juce::File(item.audioFilePath).getParentDirectory());
+			importWhileRendering(opts, previewItems);
+			return;
 		}
 
-		auto lastModificationTime = juce::Time::getCurrentTime();
+		auto renderStartTime = juce::Time::getCurrentTime();
 
 		juce::Logger::writeToLog("Sending render request to DAW");
 
 		dawContext.renderItems();
 
-		if(FileHelper::countModifiedFilesInDirectoriesSince(directorySet, lastModificationTime) != previewItems.size())
+		auto importItems = dawContext.getItemsForImport(opts);
+
+		// Confirm that files were rendered. Only the render targets are checked, items missing from the render stats were not rendered.
+		std::vector<juce::String> failedRenderTargets;
+		for(auto i = importItems.size(); i < previewItems.size(); ++i)
 		{
-			onRenderFailedDetected();
-			return;
+			failedRenderTargets.push_back(previewItems[i].audioFilePath);
 		}
 
-		auto importItems = dawContext.getItemsForImport(opts);
+		std::vector<juce::File> renderFiles;
+		for(const auto& importItem : importItems)
+		{
+			if(importItem.renderFilePath.isEmpty())
+				failedRenderTargets.push_back(importItem.audioFilePath);
+			else
+				renderFiles.emplace_back(importItem.renderFilePath);
+		}
+
+		for(const auto& renderFile : FileHelper::getFilesNotModifiedSince(renderFiles, renderStartTime))
+		{
+			failedRenderTargets.push_back(renderFile.getFullPathName());
+		}
+
+		if(!failedRenderTargets.empty())
+		{
+			onRenderFailedDetected(failedRenderTargets);
+			return;
+		}
 
 		bool showIncompletePathWarning = false;
 		bool showRenameWarning = false;
-		bool isCrossMachineTransferEnabled = applicationProperties.getIsCrossMachineTransferEnabled();
 
 		if(importItems.size() > 0)
 		{
 			for(auto& importItem : importItems)
 			{
-				if(importItem.renderFilePath.isEmpty())
-				{
-					onRenderFailedDetected();
-					return;
-				}
-
 				if(juce::File(importItem.audioFilePath) != juce::File(importItem.renderFilePath))
 					showRenameWarning = true;
 
 				if(!WwiseHelper::isPathComplete(importItem.path))
 					showIncompletePathWarning = true;
 
-				using namespace juce;
-				const File rendPath(importItem.renderFilePath);
-				importItem.renderFileName = rendPath.getFileName();
-
-				if(isCrossMachineTransferEnabled)
-				{
-					MemoryBlock mb;
-					std::unique_ptr<FileInputStream> inputStream = rendPath.createInputStream();
-					inputStream->readIntoMemoryBlock(mb);
-					importItem.renderFileWavBase64 = Base64::toBase64(mb.getData(), mb.getSize());
-					// add base64 padding
-					importItem.renderFileWavBase64 += String(std::string(4 - (importItem.renderFileWavBase64.length() % 4), '='));
-				}
+				// Render files are encoded by the import task when cross machine transfer is enabled
+				importItem.renderFileName = juce::File(importItem.renderFilePath).getFileName();
 			}
 		}
 		else
@@ -205,11 +210,17 @@ namespace AK::WwiseTransfer
 
 		juce::String title(!hasErrors ? "Wwise Import Successful" : "Wwise Imported with Errors");
 
+		if(summary.cancelled)
+			title = "Wwise Import Cancelled";
+
 		juce::String message;
 		message << summary.getNumObjectsCreated() << " object(s) created.";
 		message << juce::NewLine() << summary.getNumObjectTemplatesApplied() << " object template(s) applied.";
 		message << juce::NewLine() << summary.getNumAudiofilesTransfered() << " audio files(s) imported.";
 
+		if(summary.cancelled)
+			message << juce::NewLine() << static_cast<int>(summary.notImportedFiles.size()) << " audio file(s) not imported.";
+
 		auto messageBoxOptions = juce::MessageBoxOptions().withTitle(title).withMessage(message).withButton("View Details").withButton("Close");
 
 		auto onDialogBtnClicked = [this, summary = summary, importTaskOptions = importTaskOptions](int result)
@@ -337,11 +348,24 @@ namespace AK::WwiseTransfer
 		refreshComponent();
 	}
 
-	void ImportControlsComponent::onRenderFailedDetected()
+	void ImportControlsComponent::onRenderFailedDetected(const std::vector<juce::String>& failedRenderTargets)
 	{
-		const juce::String message("One or more files failed to render.");
+		using namespace ImportControlsComponentConstants;
+
+		juce::String message("One or more files failed to render.");
 		juce::Logger::writeToLog(message);
 
+		for(std::size_t i = 0; i < failedRenderTargets.size(); ++i)
+		{
+			juce::Logger::writeToLog("Render failed: " + failedRenderTargets[i]);
+
+			if(i < maxFailedRenderTargetsShown)
+				message << juce::NewLine() << failedRenderTargets[i];
+		}
+
+		if(failedRenderTargets.size() > maxFailedRenderTargetsShown)
+			message << juce::NewLine() << "... and " << juce::String(failedRenderTargets.size() - maxFailedRenderTargetsShown) << " more.";
+
 		juce::AlertWindow::showMessageBoxAsync(juce::MessageBoxIconType::InfoIcon, "Transfer to Wwise Aborted", message);
 
 		transferInProgress = false;
@@ -409,14 +433,75 @@ namespace AK::WwiseTransfer
 		juce::AlertWindow::showAsync(messageBoxOptions, onDialogBtnClicked);
 	}
 
-	void ImportControlsComponent::onImport(const std::vector<Import::Item>& importItems)
+	bool ImportControlsComponent::canImportWhileRendering(const std::vector<Import::PreviewItem>& previewItems)
+	{
+		if(previewItems.empty())
+			return false;
+
+		// Files are imported before the render is over, so there must be nothing left for the user to confirm once it is
+		for(const auto& previewItem : previewItems)
+		{
+			if(!WwiseHelper::isPathComplete(previewItem.path))
+				return false;
+		}
+
+		// Render files are only renamed when they already exist
+		if(applicationProperties.getShowSilentIncrementWarning())
+		{
+			std::vector<juce::String> audioFilePaths;
+			audioFilePaths.reserve(previewItems.size());
+
+			for(const auto& previewItem : previewItems)
+				audioFilePaths.push_back(previewItem.audioFilePath);
+
+			const auto audioFilesExist = DirectoryListingCache::getInstance().filesExist(audioFilePaths);
+
+			if(std::find(audioFilesExist.begin(), audioFilesExist.end(), true) != audioFilesExist.end())
+				return false;
+		}
+
+		return true;
+	}
+
+	void ImportControlsComponent::importWhileRendering(const Import::Options& options, const std::vector<Import::PreviewItem>& previewItems)
+	{
+		std::vector<juce::File> renderTargets;
+		std::vector<Import::Item> importItems;
+
+		for(const auto& previewItem : previewItems)
+		{
+			const auto& renderTarget = renderTargets.emplace_back(previewItem.audioFilePath);
+
+			// Render file paths are only known for certain once the render is over, the render watcher reports the final ones
+			importItems.push_back({previewItem, previewItem.audioFilePath, renderTarget.getFileName()});
+		}
+
+		auto renderWatcher = std::make_shared<RenderWatcher>(renderTargets, juce::Time::getCurrentTime());
+		renderWatcher->start();
+
+		onImport(importItems, renderWatcher);
+
+		juce::Logger::writeToLog("Sending render request to DAW");
+
+		dawContext.renderItems();
+
+		std::vector<juce::String> renderFilePaths;
+		for(const auto& importItem : dawContext.getItemsForImport(options))
+		{
+			renderFilePaths.push_back(importItem.renderFilePath);
+		}
+
+		renderWatcher->renderFinished(renderFilePaths);
+	}
+
+	void ImportControlsComponent::onImport(const std::vector<Import::Item>& importItems, std::shared_ptr<RenderWatcher> renderWatcher)
 	{
 		const auto hierarchyMappingNodeList = ImportHelper::valueTreeToHierarchyMappingNodeList(hierarchyMapping);
 
 		const Import::Task::Options importTaskOptions{
 			importItems, containerNameExistsOption, applyTemplateOption, importDestination, hierarchyMappingNodeList,
 			originalsFolder, languageSubfolder, selectObjectsOnImportCommand, applyTemplateFeatureEnabled, undoGroupFeatureEnabled,
-			waqlEnabled};
+			waqlEnabled, applicationProperties.getIsCrossMachineTransferEnabled()};
 
 		auto onImportComplete = [this, importTaskOptions = importTaskOptions](const Import::Summary& importSummary)
 		{
@@ -428,7 +513,7 @@ namespace AK::WwiseTransfer
 
 		juce::Logger::writeToLog("Importing files...");
 
-		importTask.reset(new ImportTask(waapiClient, importTaskOptions, onImportComplete));
+		importTask.reset(new ImportTask(waapiClient, importTaskOptions, onImportComplete, std::move(renderWatcher)));
 		importTask->launchThread();
 	}
 
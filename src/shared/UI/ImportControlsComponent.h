@@ -82,11 +82,14 @@ namespace AK::WwiseTransfer
 
 		void handleAsyncUpdate() override;
 
-		void onRenderFailedDetected();
+		void onRenderFailedDetected(const std::vector<juce::String>& failedRenderTargets);
 		void onImportCancelled();
 		void onFileRenamedDetected(bool isPathIncomplete, const std::vector<Import::Item>& importItems);
 		void onPathIncompleteDetected(const std::vector<Import::Item>& importItems);
-		void onImport(const std::vector<Import::Item>& importItems);
+		void onImport(const std::vector<Import::Item>& importItems, std::shared_ptr<RenderWatcher> renderWatcher = nullptr);
+
+		bool canImportWhileRendering(const std::vector<Import::PreviewItem>& previewItems);
+		void importWhileRendering(const Import::Options& options, const std::vector<Import::PreviewItem>& previewItems);
 
 		bool validateFullImportPathBeforeTransfer() const;
 
@@ -174,7 +174,7 @@ namespace AK::WwiseTransfer
 
 				auto previewItem = ImportHelper::valueTreeToPreviewItemNode(valueTree);
 
-				body << valueTree.getType() << "\t" << ImportHelper::objectStatusToReadableString(previewItem.objectStatus) << "\t"
+				body << valueTree[IDs::objectPath].toString() << "\t" << ImportHelper::objectStatusToReadableString(previewItem.objectStatus) << "\t"
 					 << previewItem.audioFilePath << "\t" << ImportHelper::wavStatusToReadableString(previewItem.wavStatus) << "\r\n";
 			}
 		}
@@ -253,37 +253,140 @@ namespace AK::WwiseTransfer
 		}
 	}
 
-	void ValueTreeItem::valueTreePropertyChanged(juce::ValueTree&, const juce::Identifier&)
+	void ValueTreeItem::valueTreePropertyChanged(juce::ValueTree& treeWhosePropertyHasChanged, const juce::Identifier& property)
 	{
 		repaintItem();
-	}
 
-	void ValueTreeItem::valueTreeChildAdded(juce::ValueTree& parentTree, juce::ValueTree&)
-	{
-		treeChildrenChanged(parentTree);
+		const auto sortColumnId = header.getSortColumnId();
+
+		if(treeWhosePropertyHasChanged == tree && sortColumnId > 0 && property == getPropertyForColumn(sortColumnId))
+			moveToSortedPosition();
 	}
 
-	void ValueTreeItem::valueTreeChildRemoved(juce::ValueTree& parentTree, juce::ValueTree&, int)
+	void ValueTreeItem::moveToSortedPosition()
 	{
-		treeChildrenChanged(parentTree);
+		auto* parent = getParentItem();
+
+		if(parent == nullptr)
+			return;
+
+		auto comparator = Comparator(header);
+
+		const auto index = getIndexInParent();
+		auto* previous = parent->getSubItem(index - 1);
+		auto* next = parent->getSubItem(index + 1);
+
+		if((previous == nullptr || comparator.compareElements(previous, this) <= 0) && (next == nullptr || comparator.compareElements(this, next) <= 0))
+			return;
+
+		// The item itself is moved, so its openness and sub items are kept
+		parent->removeSubItem(index, false);
+		parent->addSubItemSorted(comparator, this);
+		parent->treeHasChanged();
 	}
 
-	void ValueTreeItem::valueTreeChildOrderChanged(juce::ValueTree& parentTree, int, int)
+	void ValueTreeItem::valueTreeChildAdded(juce::ValueTree& parentTree, juce::ValueTree& childWhichHasBeenAdded)
 	{
-		treeChildrenChanged(parentTree);
+		if(parentTree != tree)
+			return;
+
+		// Sub items are created lazily when the item is first opened
+		if(isOpen() || getNumSubItems() > 0)
+		{
+			auto* subItem = new ValueTreeItem(header, childWhichHasBeenAdded);
+
+			if(header.getSortColumnId() > 0)
+			{
+				auto comparator = Comparator(header);
+				addSubItemSorted(comparator, subItem);
+			}
+			else
+			{
+				addSubItem(subItem, tree.indexOf(childWhichHasBeenAdded));
+			}
+		}
+
+		treeHasChanged();
 	}
 
-	void ValueTreeItem::valueTreeParentChanged(juce::ValueTree&)
+	void ValueTreeItem::valueTreeChildRemoved(juce::ValueTree& parentTree, juce::ValueTree& childWhichHasBeenRemoved, int indexFromWhichChildWasRemoved)
 	{
+		if(parentTree != tree)
+			return;
+
+		auto isSubItemForChild = [&childWhichHasBeenRemoved](juce::TreeViewItem* subItem)
+		{
+			auto* valueTreeItem = dynamic_cast<ValueTreeItem*>(subItem);
+			return valueTreeItem != nullptr && valueTreeItem->tree == childWhichHasBeenRemoved;
+		};
+
+		// Unsorted sub items mirror the order of the value tree children
+		if(isSubItemForChild(getSubItem(indexFromWhichChildWasRemoved)))
+		{
+			removeSubItem(indexFromWhichChildWasRemoved);
+		}
+		else
+		{
+			for(int i = 0; i < getNumSubItems(); ++i)
+			{
+				if(isSubItemForChild(getSubItem(i)))
+				{
+					removeSubItem(i);
+					break;
+				}
+			}
+		}
+
+		treeHasChanged();
 	}
 
-	void ValueTreeItem::treeChildrenChanged(const juce::ValueTree& parentTree)
+	void ValueTreeItem::valueTreeChildOrderChanged(juce::ValueTree& parentTree, int oldIndex, int newIndex)
 	{
-		if(parentTree == tree)
+		// Child order only matters when the items are not sorted by a column
+		if(parentTree != tree || header.getSortColumnId() != 0 || getNumSubItems() == 0)
+			return;
+
+		// Existing sub items are moved rather than recreated so that their openness is kept
+		auto moveSubItem = [this](int fromIndex, int toIndex)
 		{
-			refreshSubItems();
-			treeHasChanged();
+			auto* subItem = getSubItem(fromIndex);
+			removeSubItem(fromIndex, false);
+			addSubItem(subItem, toIndex);
+		};
+
+		auto isSubItemForChild = [this](int subItemIndex, int childIndex)
+		{
+			auto* valueTreeItem = dynamic_cast<ValueTreeItem*>(getSubItem(subItemIndex));
+			return valueTreeItem != nullptr && valueTreeItem->tree == tree.getChild(childIndex);
+		};
+
+		if(oldIndex != newIndex && isSubItemForChild(oldIndex, newIndex))
+		{
+			moveSubItem(oldIndex, newIndex);
+		}
+		else
+		{
+			// ValueTree::sort reports the whole reordering as a single change, so match every child to its sub item
+			for(int childIndex = 0; childIndex < tree.getNumChildren() && childIndex < getNumSubItems(); ++childIndex)
+			{
+				for(int subItemIndex = childIndex; subItemIndex < getNumSubItems(); ++subItemIndex)
+				{
+					if(isSubItemForChild(subItemIndex, childIndex))
+					{
+						if(subItemIndex != childIndex)
+							moveSubItem(subItemIndex, childIndex);
+
+						break;
+					}
+				}
+			}
 		}
+
+		treeHasChanged();
+	}
+
+	void ValueTreeItem::valueTreeParentChanged(juce::ValueTree&)
+	{
 	}
 
 	void ValueTreeItem::paintItem(juce::Graphics& g, int width, int height)
@@ -375,7 +478,24 @@ namespace AK::WwiseTransfer
 
 	juce::String ValueTreeItem::getUniqueName() const
 	{
-		return tree.getType().toString();
+		return tree[IDs::objectPath].toString();
+	}
+
+	juce::Identifier ValueTreeItem::getPropertyForColumn(int column)
+	{
+		switch(column)
+		{
+		case TreeValueItemColumn::Name:
+			return IDs::objectPath;
+		case TreeValueItemColumn::ObjectStatus:
+			return IDs::objectStatus;
+		case TreeValueItemColumn::OriginalsWav:
+			return IDs::audioFilePath;
+		case TreeValueItemColumn::WavStatus:
+			return IDs::wavStatus;
+		default:
+			return {};
+		}
 	}
 
 	juce::String ValueTreeItem::getComparisonTextForColumn(int column)
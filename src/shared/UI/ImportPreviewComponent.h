@@ -49,6 +49,7 @@ namespace AK::WwiseTransfer
 		void itemOpennessChanged(bool isNowOpen) override;
 		juce::String getUniqueName() const override;
 		juce::String getComparisonTextForColumn(int column);
+		static juce::Identifier getPropertyForColumn(int column);
 		void itemClicked(const juce::MouseEvent&) override;
 		juce::ValueTree getValueTree();
 
@@ -62,12 +63,12 @@ namespace AK::WwiseTransfer
 		juce::ValueTree tree;
 
 		void refreshSubItems();
-		void valueTreePropertyChanged(juce::ValueTree&, const juce::Identifier&) override;
-		void valueTreeChildAdded(juce::ValueTree& parentTree, juce::ValueTree&) override;
-		void valueTreeChildRemoved(juce::ValueTree& parentTree, juce::ValueTree&, int) override;
-		void valueTreeChildOrderChanged(juce::ValueTree& parentTree, int, int) override;
+		void moveToSortedPosition();
+		void valueTreePropertyChanged(juce::ValueTree& treeWhosePropertyHasChanged, const juce::Identifier& property) override;
+		void valueTreeChildAdded(juce::ValueTree& parentTree, juce::ValueTree& childWhichHasBeenAdded) override;
+		void valueTreeChildRemoved(juce::ValueTree& parentTree, juce::ValueTree& childWhichHasBeenRemoved, int indexFromWhichChildWasRemoved) override;
+		void valueTreeChildOrderChanged(juce::ValueTree& parentTree, int oldIndex, int newIndex) override;
 		void valueTreeParentChanged(juce::ValueTree&) override;
-		void treeChildrenChanged(const juce::ValueTree& parentTree);
 		void paintItem(juce::Graphics& g, int width, int height) override;
 		void tableColumnsChanged(juce::TableHeaderComponent* tableHeader) override;
 		void tableColumnsResized(juce::TableHeaderComponent* tableHeader) override;
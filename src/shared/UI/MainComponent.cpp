@@ -68,6 +68,8 @@ namespace AK::WwiseTransfer
 
 		juce::Logger::setCurrentLogger(&logger);
 
+		waapiClient.setLogLevel(applicationProperties.getWaapiLogLevel());
+
 		splitter.getToggleStateValue().referTo(collapsedUI.getPropertyAsValue());
 
 		waapiClientWatcher.start();
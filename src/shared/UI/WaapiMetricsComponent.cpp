@@ -0,0 +1,110 @@
+/*----------------------------------------------------------------------------------------
+
+Copyright (c) 2025 AUDIOKINETIC Inc.
+
+This file is licensed to use under the license available at:
+https://github.com/audiokinetic/ReaWwise/blob/main/License.txt (the "License").
+You may not use this file except in compliance with the License.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations under the License.
+
+----------------------------------------------------------------------------------------*/
+
+#include "WaapiMetricsComponent.h"
+
+#include "Core/WaapiMetrics.h"
+
+namespace AK::WwiseTransfer
+{
+	namespace WaapiMetricsComponentConstants
+	{
+		constexpr int buttonHeight = 26;
+		constexpr int buttonWidth = 80;
+		constexpr int margin = 10;
+		constexpr int width = 560;
+		constexpr int height = 360;
+		constexpr int refreshIntervalMs = 1000;
+	} // namespace WaapiMetricsComponentConstants
+
+	WaapiMetricsComponent::WaapiMetricsComponent()
+	{
+		using namespace WaapiMetricsComponentConstants;
+
+		setSize(width, height);
+		setLookAndFeel(&lookAndFeel);
+
+		metricsTextEditor.setMultiLine(true);
+		metricsTextEditor.setReadOnly(true);
+		metricsTextEditor.setScrollbarsShown(true);
+		metricsTextEditor.setFont(juce::Font(juce::Font::getDefaultMonospacedFontName(), CustomLookAndFeelConstants::smallFontSize, juce::Font::plain));
+
+		resetButton.setButtonText("Reset");
+		resetButton.onClick = [this]
+		{
+			WaapiMetrics::getInstance().reset();
+			refresh();
+		};
+
+		addAndMakeVisible(metricsTextEditor);
+		addAndMakeVisible(resetButton);
+	}
+
+	WaapiMetricsComponent::~WaapiMetricsComponent()
+	{
+		setLookAndFeel(nullptr);
+	}
+
+	void WaapiMetricsComponent::resized()
+	{
+		using namespace WaapiMetricsComponentConstants;
+
+		auto area = getLocalBounds();
+		area.reduce(margin, margin);
+
+		resetButton.setBounds(area.removeFromBottom(buttonHeight).removeFromRight(buttonWidth));
+
+		area.removeFromBottom(margin);
+
+		metricsTextEditor.setBounds(area);
+	}
+
+	void WaapiMetricsComponent::paint(juce::Graphics& g)
+	{
+		g.fillAll(getLookAndFeel().findColour(juce::ResizableWindow::backgroundColourId));
+	}
+
+	void WaapiMetricsComponent::visibilityChanged()
+	{
+		updateTimer();
+	}
+
+	void WaapiMetricsComponent::parentHierarchyChanged()
+	{
+		updateTimer();
+	}
+
+	void WaapiMetricsComponent::updateTimer()
+	{
+		// Only poll the metrics while they are shown
+		if(isShowing())
+		{
+			refresh();
+			startTimer(WaapiMetricsComponentConstants::refreshIntervalMs);
+		}
+		else
+			stopTimer();
+	}
+
+	void WaapiMetricsComponent::refresh()
+	{
+		metricsTextEditor.setText(WaapiMetrics::getInstance().toText(), false);
+	}
+
+	void WaapiMetricsComponent::timerCallback()
+	{
+		refresh();
+	}
+} // namespace AK::WwiseTransfer
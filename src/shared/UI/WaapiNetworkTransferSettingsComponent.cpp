@@ -31,7 +31,7 @@ namespace AK::WwiseTransfer
 		constexpr int labelWidth = 220;
 		constexpr int margin = 10;
 		constexpr int width = 370;
-		constexpr int height = 100;
+		constexpr int height = 126;
 	} // namespace CrossMachineTransferComponentConstants
 
 	WaapiNetworkTransferSettingsComponent::WaapiNetworkTransferSettingsComponent(const juce::String& applicationName,
@@ -91,6 +91,20 @@ namespace AK::WwiseTransfer
 
 		addAndMakeVisible(enableCrossMachineTransferLabel);
 		addAndMakeVisible(enableCrossMachineTransferButton);
+
+		metricsLabel.setText("WAAPI Call Metrics", juce::dontSendNotification);
+		metricsLabel.setBorderSize(juce::BorderSize(0));
+		metricsLabel.setMinimumHorizontalScale(1.0f);
+		metricsLabel.setJustificationType(juce::Justification::left);
+
+		showMetricsButton.setButtonText("Show");
+		showMetricsButton.onClick = [this]
+		{
+			showMetricsWindow();
+		};
+
+		addAndMakeVisible(metricsLabel);
+		addAndMakeVisible(showMetricsButton);
 	}
 
 	WaapiNetworkTransferSettingsComponent::~WaapiNetworkTransferSettingsComponent()
@@ -128,6 +142,14 @@ namespace AK::WwiseTransfer
 
 			portTextEditor.setBounds(portSection);
 		}
+
+		auto metricsSection = area.removeFromTop(editorBoxHeight);
+		{
+			metricsLabel.setBounds(metricsSection.removeFromLeft(labelWidth));
+			metricsSection.removeFromLeft(margin);
+
+			showMetricsButton.setBounds(metricsSection);
+		}
 	}
 
 	void WaapiNetworkTransferSettingsComponent::paint(juce::Graphics& g)
@@ -144,4 +166,16 @@ namespace AK::WwiseTransfer
 		if(!onInit)
 			waapiClientWatcher.changeParameters(applicationProperties.getWaapiIp(), applicationProperties.getWaapiPort());
 	}
+
+	void WaapiNetworkTransferSettingsComponent::showMetricsWindow()
+	{
+		juce::DialogWindow::LaunchOptions options;
+		options.dialogTitle = "WAAPI Call Metrics";
+		options.useNativeTitleBar = true;
+		options.resizable = true;
+		options.componentToCentreAround = this;
+		options.content = juce::OptionalScopedPointer<juce::Component>(&metricsComponent, false);
+
+		options.launchAsync();
+	}
 } // namespace AK::WwiseTransfer
@@ -18,6 +18,7 @@ specific language governing permissions and limitations under the License.
 #include "Core/WaapiClient.h"
 #include "Persistance/ApplicationProperties.h"
 #include "Theme/CustomLookAndFeel.h"
+#include "WaapiMetricsComponent.h"
 
 #include <juce_gui_basics/juce_gui_basics.h>
 
@@ -44,10 +45,15 @@ namespace AK::WwiseTransfer
 		juce::Label portLabel;
 		juce::TextEditor portTextEditor;
 
+		juce::Label metricsLabel;
+		juce::TextButton showMetricsButton;
+		WaapiMetricsComponent metricsComponent;
+
 		ApplicationProperties& applicationProperties;
 		WaapiClientWatcher& waapiClientWatcher;
 
 		void setToCrossMachineTransfer(bool isCrossMachineTransfer, bool onInit = false);
+		void showMetricsWindow();
 
 		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WaapiNetworkTransferSettingsComponent)
 	};
@@ -0,0 +1,176 @@
+/*----------------------------------------------------------------------------------------
+
+Copyright (c) 2025 AUDIOKINETIC Inc.
+
+This file is licensed to use under the license available at:
+https://github.com/audiokinetic/ReaWwise/blob/main/License.txt (the "License").
+You may not use this file except in compliance with the License.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations under the License.
+
+----------------------------------------------------------------------------------------*/
+
+#include "Core/AudioFileEncoder.h"
+#include "Helpers/Base64Helper.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+
+namespace AK::WwiseTransfer::Test
+{
+	namespace
+	{
+		// Bigger than the encoder's chunks, so that files are read in several of them
+		constexpr std::size_t fileSize = 500'000;
+
+		juce::MemoryBlock createRandomData(std::size_t size, int seed)
+		{
+			juce::MemoryBlock data(size);
+			juce::Random random(seed);
+
+			for(std::size_t i = 0; i < size; ++i)
+				data[i] = static_cast<char>(random.nextInt(256));
+
+			return data;
+		}
+
+		Waapi::ImportItemRequest createRequest(const juce::File& renderFile)
+		{
+			Waapi::ImportItemRequest importItemRequest;
+			importItemRequest.renderFilePath = renderFile.getFullPathName();
+			importItemRequest.renderFileName = renderFile.getFileName();
+
+			return importItemRequest;
+		}
+
+		// Waits for a batch on another thread, so that the test can check whether it is still blocked
+		struct PendingCompletion
+		{
+			juce::WaitableEvent completed;
+			std::vector<juce::String> failedFiles;
+		};
+
+		std::shared_ptr<PendingCompletion> waitForCompletionAsync(AudioFileEncoder& encoder, const std::shared_ptr<AudioFileEncoder::EncodingBatch>& encodingBatch)
+		{
+			auto pendingCompletion = std::make_shared<PendingCompletion>();
+
+			juce::Thread::launch([&encoder, encodingBatch, pendingCompletion]
+				{
+					pendingCompletion->failedFiles = encoder.waitForCompletion(encodingBatch);
+					pendingCompletion->completed.signal();
+				});
+
+			return pendingCompletion;
+		}
+	} // namespace
+
+	TEST_CASE("AudioFileEncoder")
+	{
+		auto tmpDir = juce::File::getSpecialLocation(juce::File::SpecialLocationType::tempDirectory)
+		                  .getChildFile("temp_" + juce::String::toHexString(juce::Random::getSystemRandom().nextInt()));
+
+		tmpDir.createDirectory();
+
+		const auto firstData = createRandomData(fileSize, 1);
+		const auto secondData = createRandomData(fileSize, 2);
+
+		const auto firstFile = tmpDir.getChildFile("First.wav");
+		const auto secondFile = tmpDir.getChildFile("Second.wav");
+		const auto missingFile = tmpDir.getChildFile("Missing.wav");
+
+		firstFile.replaceWithData(firstData.getData(), firstData.getSize());
+		secondFile.replaceWithData(secondData.getData(), secondData.getSize());
+
+		const auto encodedSize = Base64Helper::getEncodedSize(fileSize);
+
+		auto cancellationToken = std::make_shared<WaapiHelper::CancellationToken>();
+
+		SECTION("Files are encoded in full")
+		{
+			AudioFileEncoder encoder(2 * encodedSize, 2, cancellationToken);
+
+			std::vector<Waapi::ImportItemRequest> importItemRequests{createRequest(firstFile), createRequest(secondFile)};
+
+			REQUIRE(encoder.waitForCompletion(encoder.encodeAsync(importItemRequests)).empty());
+			REQUIRE(importItemRequests[0].renderFileWavBase64 == Base64Helper::encode(firstData.getData(), firstData.getSize()));
+			REQUIRE(importItemRequests[1].renderFileWavBase64 == Base64Helper::encode(secondData.getData(), secondData.getSize()));
+
+			encoder.release(importItemRequests);
+
+			REQUIRE(importItemRequests[0].renderFileWavBase64.empty());
+		}
+
+		SECTION("Files that cannot be read are reported")
+		{
+			AudioFileEncoder encoder(2 * encodedSize, 2, cancellationToken);
+
+			std::vector<Waapi::ImportItemRequest> importItemRequests{createRequest(firstFile), createRequest(missingFile)};
+
+			const auto failedFiles = encoder.waitForCompletion(encoder.encodeAsync(importItemRequests));
+
+			REQUIRE(failedFiles == std::vector<juce::String>{missingFile.getFullPathName()});
+			REQUIRE(importItemRequests[0].renderFileWavBase64 == Base64Helper::encode(firstData.getData(), firstData.getSize()));
+			REQUIRE(importItemRequests[1].renderFileWavBase64.empty());
+		}
+
+		SECTION("Encoding waits for memory to be released once the budget is used")
+		{
+			AudioFileEncoder encoder(encodedSize, 2, cancellationToken);
+
+			std::vector<Waapi::ImportItemRequest> firstBatch{createRequest(firstFile)};
+			std::vector<Waapi::ImportItemRequest> secondBatch{createRequest(secondFile)};
+
+			REQUIRE(encoder.waitForCompletion(encoder.encodeAsync(firstBatch)).empty());
+
+			auto pendingCompletion = waitForCompletionAsync(encoder, encoder.encodeAsync(secondBatch));
+
+			REQUIRE_FALSE(pendingCompletion->completed.wait(200));
+
+			encoder.release(firstBatch);
+
+			REQUIRE(pendingCompletion->completed.wait(5'000));
+			REQUIRE(pendingCompletion->failedFiles.empty());
+			REQUIRE(secondBatch[0].renderFileWavBase64 == Base64Helper::encode(secondData.getData(), secondData.getSize()));
+		}
+
+		SECTION("Files waiting for memory fail once cancelled")
+		{
+			AudioFileEncoder encoder(encodedSize, 2, cancellationToken);
+
+			std::vector<Waapi::ImportItemRequest> firstBatch{createRequest(firstFile)};
+			std::vector<Waapi::ImportItemRequest> secondBatch{createRequest(secondFile)};
+
+			REQUIRE(encoder.waitForCompletion(encoder.encodeAsync(firstBatch)).empty());
+
+			auto pendingCompletion = waitForCompletionAsync(encoder, encoder.encodeAsync(secondBatch));
+
+			REQUIRE_FALSE(pendingCompletion->completed.wait(200));
+
+			cancellationToken->cancel();
+
+			REQUIRE(pendingCompletion->completed.wait(5'000));
+			REQUIRE(pendingCompletion->failedFiles == std::vector<juce::String>{secondFile.getFullPathName()});
+			REQUIRE(secondBatch[0].renderFileWavBase64.empty());
+		}
+
+		SECTION("Files are not encoded once cancelled")
+		{
+			AudioFileEncoder encoder(2 * encodedSize, 2, cancellationToken);
+
+			cancellationToken->cancel();
+
+			std::vector<Waapi::ImportItemRequest> importItemRequests{createRequest(firstFile), createRequest(secondFile)};
+
+			const auto failedFiles = encoder.waitForCompletion(encoder.encodeAsync(importItemRequests));
+
+			REQUIRE(failedFiles.size() == 2);
+			REQUIRE(importItemRequests[0].renderFileWavBase64.empty());
+			REQUIRE(importItemRequests[1].renderFileWavBase64.empty());
+		}
+
+		tmpDir.deleteRecursively();
+	}
+} // namespace AK::WwiseTransfer::Test
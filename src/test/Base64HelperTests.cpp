@@ -0,0 +1,121 @@
+/*----------------------------------------------------------------------------------------
+
+Copyright (c) 2025 AUDIOKINETIC Inc.
+
+This file is licensed to use under the license available at:
+https://github.com/audiokinetic/ReaWwise/blob/main/License.txt (the "License").
+You may not use this file except in compliance with the License.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations under the License.
+
+----------------------------------------------------------------------------------------*/
+
+#include "Helpers/Base64Helper.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <juce_core/juce_core.h>
+
+namespace AK::WwiseTransfer::Test
+{
+	namespace
+	{
+		juce::MemoryBlock createRandomData(std::size_t size)
+		{
+			juce::MemoryBlock data(size);
+			juce::Random random(42);
+
+			for(std::size_t i = 0; i < size; ++i)
+				data[i] = static_cast<char>(random.nextInt(256));
+
+			return data;
+		}
+	} // namespace
+
+	TEST_CASE("Base64Helper::getEncodedSize")
+	{
+		REQUIRE(Base64Helper::getEncodedSize(0) == 0);
+		REQUIRE(Base64Helper::getEncodedSize(1) == 4);
+		REQUIRE(Base64Helper::getEncodedSize(2) == 4);
+		REQUIRE(Base64Helper::getEncodedSize(3) == 4);
+		REQUIRE(Base64Helper::getEncodedSize(4) == 8);
+	}
+
+	TEST_CASE("Base64Helper::encode")
+	{
+		auto kernel = GENERATE(Base64Helper::Kernel::Scalar, Base64Helper::Kernel::SSE2, Base64Helper::Kernel::AVX2);
+
+		// Kernels the machine does not support have nothing to test
+		if(!Base64Helper::isKernelSupported(kernel))
+			return;
+
+		SECTION("Padding")
+		{
+			auto encode = [kernel](const std::string& input)
+			{
+				std::string output(Base64Helper::getEncodedSize(input.size()), '\0');
+				Base64Helper::encode(input.data(), input.size(), output.data(), kernel);
+
+				return output;
+			};
+
+			REQUIRE(encode("") == "");
+			REQUIRE(encode("M") == "TQ==");
+			REQUIRE(encode("Ma") == "TWE=");
+			REQUIRE(encode("Man") == "TWFu");
+			REQUIRE(encode("ManMa") == "TWFuTWE=");
+		}
+
+		SECTION("Matches juce::Base64 for every input size and alignment")
+		{
+			const auto data = createRandomData(300);
+
+			for(std::size_t offset = 0; offset < 3; ++offset)
+			{
+				for(std::size_t size = 0; size + offset <= data.getSize(); ++size)
+				{
+					const auto input = static_cast<const char*>(data.getData()) + offset;
+
+					std::string output(Base64Helper::getEncodedSize(size), '\0');
+					Base64Helper::encode(input, size, output.data(), kernel);
+
+					REQUIRE(output == juce::Base64::toBase64(input, size).toStdString());
+				}
+			}
+		}
+	}
+
+	TEST_CASE("Base64Helper benchmark", "[.benchmark]")
+	{
+		auto size = GENERATE(std::size_t(1) << 20, std::size_t(50) << 20, std::size_t(500) << 20);
+
+		const auto data = createRandomData(size);
+		const auto sizeLabel = juce::String(static_cast<int>(size >> 20)) + " MB";
+
+		BENCHMARK(("juce::Base64::toBase64 " + sizeLabel).toStdString())
+		{
+			return juce::Base64::toBase64(data.getData(), data.getSize());
+		};
+
+		for(auto kernel : {Base64Helper::Kernel::Scalar, Base64Helper::Kernel::SSE2, Base64Helper::Kernel::AVX2})
+		{
+			if(!Base64Helper::isKernelSupported(kernel))
+				continue;
+
+			const juce::String kernelName = kernel == Base64Helper::Kernel::AVX2 ? "AVX2" : kernel == Base64Helper::Kernel::SSE2 ? "SSE2"
+			                                                                                                                    : "Scalar";
+
+			BENCHMARK(("Base64Helper::encode " + kernelName + " " + sizeLabel).toStdString())
+			{
+				std::string output(Base64Helper::getEncodedSize(data.getSize()), '\0');
+				Base64Helper::encode(data.getData(), data.getSize(), output.data(), kernel);
+
+				return output;
+			};
+		}
+	}
+} // namespace AK::WwiseTransfer::Test
@@ -0,0 +1,97 @@
+/*----------------------------------------------------------------------------------------
+
+Copyright (c) 2025 AUDIOKINETIC Inc.
+
+This file is licensed to use under the license available at:
+https://github.com/audiokinetic/ReaWwise/blob/main/License.txt (the "License").
+You may not use this file except in compliance with the License.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations under the License.
+
+----------------------------------------------------------------------------------------*/
+
+#include "Core/DirectoryListingCache.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <filesystem>
+
+namespace AK::WwiseTransfer::Test
+{
+	TEST_CASE("DirectoryListingCache")
+	{
+		auto tmpDir = juce::File::getSpecialLocation(juce::File::SpecialLocationType::tempDirectory)
+		                  .getChildFile("temp_" + juce::String::toHexString(juce::Random::getSystemRandom().nextInt()));
+
+		tmpDir.createDirectory();
+		tmpDir.getChildFile("Existing.wav").create();
+		tmpDir.getChildFile("Subfolder").createDirectory();
+		tmpDir.getChildFile("Subfolder").getChildFile("Nested.wav").create();
+
+		auto& directoryListingCache = DirectoryListingCache::getInstance();
+		directoryListingCache.clear();
+
+		SECTION("Files are resolved across directories")
+		{
+			std::vector<juce::String> filePaths{
+				tmpDir.getChildFile("Existing.wav").getFullPathName(),
+				tmpDir.getChildFile("Missing.wav").getFullPathName(),
+				tmpDir.getChildFile("Subfolder").getChildFile("Nested.wav").getFullPathName(),
+				tmpDir.getChildFile("MissingFolder").getChildFile("Existing.wav").getFullPathName(),
+			};
+
+			REQUIRE(directoryListingCache.filesExist(filePaths) == std::vector<bool>{true, false, true, false});
+		}
+
+		SECTION("Case sensitivity follows the platform")
+		{
+			std::vector<juce::String> filePaths{tmpDir.getChildFile("EXISTING.WAV").getFullPathName()};
+
+			REQUIRE(directoryListingCache.filesExist(filePaths) == std::vector<bool>{DirectoryListingCache::isCaseInsensitive});
+		}
+
+		SECTION("New files are picked up")
+		{
+			std::vector<juce::String> filePaths{tmpDir.getChildFile("New.wav").getFullPathName()};
+
+			REQUIRE(directoryListingCache.filesExist(filePaths) == std::vector<bool>{false});
+
+			tmpDir.getChildFile("New.wav").create();
+
+			REQUIRE(directoryListingCache.filesExist(filePaths) == std::vector<bool>{true});
+		}
+
+		SECTION("Listings are reused until the directory modification time changes")
+		{
+			// juce::File cannot set the times of a directory on every platform
+			const auto directoryPath = std::filesystem::u8path(tmpDir.getFullPathName().toStdString());
+			const auto setDirectoryModificationTime = [&directoryPath](std::filesystem::file_time_type time)
+			{
+				std::filesystem::last_write_time(directoryPath, time);
+			};
+
+			// Older than the modification time resolution, so that the listing is trusted
+			const auto modificationTime = std::filesystem::last_write_time(directoryPath) - std::chrono::minutes(1);
+			setDirectoryModificationTime(modificationTime);
+
+			std::vector<juce::String> filePaths{tmpDir.getChildFile("Unlisted.wav").getFullPathName()};
+
+			REQUIRE(directoryListingCache.filesExist(filePaths) == std::vector<bool>{false});
+
+			// Only a new listing would see the file
+			tmpDir.getChildFile("Unlisted.wav").create();
+			setDirectoryModificationTime(modificationTime);
+
+			REQUIRE(directoryListingCache.filesExist(filePaths) == std::vector<bool>{false});
+
+			setDirectoryModificationTime(modificationTime + std::chrono::seconds(10));
+
+			REQUIRE(directoryListingCache.filesExist(filePaths) == std::vector<bool>{true});
+		}
+
+		tmpDir.deleteRecursively();
+	}
+} // namespace AK::WwiseTransfer::Test
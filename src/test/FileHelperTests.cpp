@@ -15,69 +15,40 @@ specific language governing permissions and limitations under the License.
 
 #include "Helpers/FileHelper.h"
 
+#include <algorithm>
 #include <catch2/catch_test_macros.hpp>
 
 namespace AK::WwiseTransfer::Test
 {
-	TEST_CASE("countModifiedFilesInDirectoriesSince")
+	TEST_CASE("getFilesNotModifiedSince")
 	{
-		SECTION("One directory, multiple files created at same time")
-		{
-			auto tmpDir = juce::File::getSpecialLocation(juce::File::SpecialLocationType::tempDirectory)
-			                  .getChildFile("temp_" + juce::String::toHexString(juce::Random::getSystemRandom().nextInt()));
+		auto tmpDir = juce::File::getSpecialLocation(juce::File::SpecialLocationType::tempDirectory)
+		                  .getChildFile("temp_" + juce::String::toHexString(juce::Random::getSystemRandom().nextInt()));
 
-			tmpDir.createDirectory();
+		tmpDir.createDirectory();
 
-			auto time = juce::Time::getCurrentTime();
+		auto time = juce::Time::getCurrentTime();
 
-			juce::Time::waitForMillisecondCounter(juce::Time::getMillisecondCounter() + 100);
+		auto staleFile = tmpDir.getChildFile("staleFile.wav");
+		staleFile.create();
+		staleFile.setLastModificationTime(time - juce::RelativeTime::hours(1));
 
-			tmpDir.getChildFile("tempFile1.txt").create();
-			tmpDir.getChildFile("tempFile2.txt").create();
+		auto renderedFile = tmpDir.getChildFile("renderedFile.wav");
+		renderedFile.create();
 
-			std::set<juce::File> directorySet = {
-				tmpDir};
+		auto missingFile = tmpDir.getChildFile("missingFile.wav");
 
-			REQUIRE(FileHelper::countModifiedFilesInDirectoriesSince(directorySet, time) == 2);
+		// Stale as well, but it was not asked about
+		auto unrelatedFile = tmpDir.getChildFile("unrelatedFile.wav");
+		unrelatedFile.create();
+		unrelatedFile.setLastModificationTime(time - juce::RelativeTime::hours(1));
 
-			juce::Time::waitForMillisecondCounter(juce::Time::getMillisecondCounter() + 100);
+		auto filesNotModified = FileHelper::getFilesNotModifiedSince({staleFile, renderedFile, missingFile}, time);
 
-			time = juce::Time::getCurrentTime();
+		REQUIRE(filesNotModified == std::vector<juce::File>{staleFile, missingFile});
+		REQUIRE(std::find(filesNotModified.begin(), filesNotModified.end(), unrelatedFile) == filesNotModified.end());
+		REQUIRE(FileHelper::getFilesNotModifiedSince({}, time).empty());
 
-			REQUIRE(FileHelper::countModifiedFilesInDirectoriesSince(directorySet, time) == 0);
-		}
-
-		SECTION("Multiple directories, multiple files created at different times")
-		{
-			auto tmpDir1 = juce::File::getSpecialLocation(juce::File::SpecialLocationType::tempDirectory)
-			                   .getChildFile("temp_" + juce::String::toHexString(juce::Random::getSystemRandom().nextInt()));
-
-			auto tmpDir2 = juce::File::getSpecialLocation(juce::File::SpecialLocationType::tempDirectory)
-			                   .getChildFile("temp_" + juce::String::toHexString(juce::Random::getSystemRandom().nextInt()));
-
-			tmpDir1.createDirectory();
-			tmpDir2.createDirectory();
-
-			auto time = juce::Time::getCurrentTime();
-
-			juce::Time::waitForMillisecondCounter(juce::Time::getMillisecondCounter() + 100);
-
-			tmpDir1.getChildFile("tempFile1.txt").create();
-			tmpDir2.getChildFile("tempFile2.txt").create();
-
-			std::set<juce::File> directorySet = {
-				tmpDir1,
-				tmpDir2};
-
-			REQUIRE(FileHelper::countModifiedFilesInDirectoriesSince(directorySet, time) == 2);
-
-			time = juce::Time::getCurrentTime();
-
-			juce::Time::waitForMillisecondCounter(juce::Time::getMillisecondCounter() + 100);
-
-			tmpDir1.getChildFile("tempFile3.txt").create();
-
-			REQUIRE(FileHelper::countModifiedFilesInDirectoriesSince(directorySet, time) == 1);
-		}
+		tmpDir.deleteRecursively();
 	}
 } // namespace AK::WwiseTransfer::Test
@@ -226,5 +226,327 @@ namespace AK::WwiseTransfer::Test
 
 			REQUIRE(ImportHelper::importPreviewItemsToHash(testItems1) != ImportHelper::importPreviewItemsToHash(testItems2));
 		}
+		SECTION("Order Independence Check")
+		{
+			auto testItems = std::vector<Import::PreviewItem>();
+			for(int index = 0; index < 10; index++)
+			{
+				testItems.emplace_back(TestImportPreviewItemValues(index).generateImportPreviewItem());
+			}
+
+			auto reversedItems = std::vector<Import::PreviewItem>(testItems.rbegin(), testItems.rend());
+
+			REQUIRE(ImportHelper::importPreviewItemsToHash(testItems) == ImportHelper::importPreviewItemsToHash(reversedItems));
+		}
+	}
+
+	TEST_CASE("getPreviewItemChanges")
+	{
+		auto previousItems = std::vector<Import::PreviewItem>();
+		for(int index = 0; index < 5; index++)
+		{
+			previousItems.emplace_back(TestImportPreviewItemValues(index).generateImportPreviewItem());
+		}
+
+		const auto previous = ImportHelper::getPreviewItemFingerprints(previousItems);
+
+		SECTION("The digest matches the hash of the items")
+		{
+			REQUIRE(previous.digest == ImportHelper::importPreviewItemsToHash(previousItems));
+		}
+
+		SECTION("Identical items produce no changes")
+		{
+			auto currentItems = std::vector<Import::PreviewItem>(previousItems.rbegin(), previousItems.rend());
+			const auto current = ImportHelper::getPreviewItemFingerprints(currentItems);
+
+			REQUIRE(current.digest == previous.digest);
+			REQUIRE(ImportHelper::getPreviewItemChanges(previous, current).isEmpty());
+		}
+
+		SECTION("Added, removed and modified items are reported")
+		{
+			auto currentItems = previousItems;
+			currentItems.erase(currentItems.begin());
+			currentItems[0].path = "\\test\\item\\renamed";
+			currentItems.emplace_back(TestImportPreviewItemValues(5).generateImportPreviewItem());
+
+			const auto current = ImportHelper::getPreviewItemFingerprints(currentItems);
+			const auto changes = ImportHelper::getPreviewItemChanges(previous, current);
+
+			REQUIRE(current.digest != previous.digest);
+			REQUIRE(changes.size() == 3);
+			REQUIRE(changes.added.size() == 1);
+			REQUIRE(changes.added[0].audioFilePath == currentItems.back().audioFilePath);
+			REQUIRE(changes.removed.size() == 1);
+			REQUIRE(changes.removed[0].audioFilePath == previousItems[0].audioFilePath);
+			REQUIRE(changes.modified.size() == 1);
+			REQUIRE(changes.modified[0].previous.path == previousItems[1].path);
+			REQUIRE(changes.modified[0].current.path == currentItems[0].path);
+		}
+
+		SECTION("Items sharing an audio file are folded together in any order")
+		{
+			auto duplicateItem1 = previousItems[0];
+			duplicateItem1.path = "\\test\\item\\duplicate1";
+
+			auto duplicateItem2 = previousItems[0];
+			duplicateItem2.path = "\\test\\item\\duplicate2";
+
+			auto currentItems = previousItems;
+			currentItems.emplace_back(duplicateItem1);
+			currentItems.emplace_back(duplicateItem2);
+
+			auto reorderedItems = previousItems;
+			reorderedItems.emplace_back(duplicateItem2);
+			reorderedItems.insert(reorderedItems.begin(), duplicateItem1);
+
+			const auto current = ImportHelper::getPreviewItemFingerprints(currentItems);
+			const auto reordered = ImportHelper::getPreviewItemFingerprints(reorderedItems);
+
+			REQUIRE(current.byAudioFilePath.size() == previous.byAudioFilePath.size());
+			REQUIRE(current.byAudioFilePath.at(previousItems[0].audioFilePath).fingerprint == reordered.byAudioFilePath.at(previousItems[0].audioFilePath).fingerprint);
+			REQUIRE(current.digest == reordered.digest);
+			REQUIRE(ImportHelper::getPreviewItemChanges(current, reordered).isEmpty());
+
+			const auto changes = ImportHelper::getPreviewItemChanges(previous, current);
+
+			REQUIRE(changes.modified.size() == 1);
+			REQUIRE(changes.added.size() == 2);
+			REQUIRE(changes.removed.empty());
+		}
+	}
+
+	TEST_CASE("removePreviewItemRows and mergePreviewItems")
+	{
+		auto createRow = [](const juce::String& path, const juce::String& audioFilePath)
+		{
+			Import::PreviewItemNode previewItem{path.fromLastOccurrenceOf("\\", false, false), Wwise::ObjectType::SoundVoice, Import::ObjectStatus::New, audioFilePath,
+				audioFilePath.isEmpty() ? Import::WavStatus::Unknown : Import::WavStatus::New, false};
+			return ImportHelper::previewItemNodeToValueTree(path, previewItem);
+		};
+
+		juce::ValueTree previewItems(IDs::previewItems);
+		auto parent = createRow("\\Parent", "");
+		parent.appendChild(createRow("\\Parent\\A", "A.wav"), nullptr);
+		parent.appendChild(createRow("\\Parent\\B", "B.wav"), nullptr);
+		previewItems.appendChild(parent, nullptr);
+
+		auto childA = parent.getChild(0);
+
+		SECTION("Removing the last item of an ancestor removes the ancestor")
+		{
+			ImportHelper::removePreviewItemRows(previewItems, {{"\\Parent\\B", "B.wav"}});
+
+			REQUIRE(parent.getNumChildren() == 1);
+			REQUIRE(parent.getChild(0) == childA);
+
+			ImportHelper::removePreviewItemRows(previewItems, {{"\\Parent\\A", "A.wav"}});
+
+			REQUIRE(previewItems.getNumChildren() == 0);
+		}
+
+		SECTION("Rows are told apart by their audio file")
+		{
+			parent.appendChild(createRow("\\Parent\\A", "A-002.wav"), nullptr);
+
+			ImportHelper::removePreviewItemRows(previewItems, {{"\\Parent\\A", "A-002.wav"}});
+
+			REQUIRE(parent.getNumChildren() == 2);
+			REQUIRE(parent.getChild(0) == childA);
+		}
+
+		SECTION("Merged rows are added without touching the others")
+		{
+			juce::ValueTree addedRows(IDs::previewItems);
+			auto addedParent = createRow("\\Parent", "");
+			addedParent.setProperty(IDs::objectStatus, juce::VariantConverter<Import::ObjectStatus>::toVar(Import::ObjectStatus::NoChange), nullptr);
+			addedParent.appendChild(createRow("\\Parent\\A", "A-002.wav"), nullptr);
+			addedParent.appendChild(createRow("\\Parent\\C", "C.wav"), nullptr);
+			addedRows.appendChild(addedParent, nullptr);
+
+			ImportHelper::mergePreviewItems(previewItems, addedRows);
+
+			REQUIRE(previewItems.getNumChildren() == 1);
+			REQUIRE(previewItems.getChild(0) == parent);
+			REQUIRE(juce::VariantConverter<Import::ObjectStatus>::fromVar(parent[IDs::objectStatus]) == Import::ObjectStatus::NoChange);
+			REQUIRE(parent.getNumChildren() == 4);
+			REQUIRE(parent.getChild(0) == childA);
+			REQUIRE(childA[IDs::audioFilePath] == "A.wav");
+			REQUIRE(parent.getChild(2)[IDs::audioFilePath] == "A-002.wav");
+			REQUIRE(parent.getChild(3)[IDs::audioFilePath] == "C.wav");
+		}
+	}
+
+	TEST_CASE("splitImportItemRequestsIntoBatches")
+	{
+		auto createImportItemRequests = [](int count)
+		{
+			std::vector<Waapi::ImportItemRequest> importItemRequests;
+
+			for(int index = 0; index < count; index++)
+			{
+				juce::String strIndex(index);
+				importItemRequests.emplace_back(Waapi::ImportItemRequest{"\\Actor-Mixer Hierarchy\\Default Work Unit\\<Sound SFX>Test_" + strIndex, "", "C:\\Renders\\Test_" + strIndex + ".wav", "Test_" + strIndex + ".wav"});
+			}
+
+			return importItemRequests;
+		};
+
+		SECTION("Empty request list produces no batch")
+		{
+			REQUIRE(ImportHelper::splitImportItemRequestsIntoBatches({}, 10, 1024).empty());
+		}
+
+		SECTION("Batches are capped by item count")
+		{
+			auto batches = ImportHelper::splitImportItemRequestsIntoBatches(createImportItemRequests(25), 10, std::numeric_limits<std::size_t>::max());
+
+			REQUIRE(batches.size() == 3);
+			REQUIRE(batches[0].size() == 10);
+			REQUIRE(batches[1].size() == 10);
+			REQUIRE(batches[2].size() == 5);
+			REQUIRE(batches[2].back().path.endsWith("Test_24"));
+		}
+
+		SECTION("Batches are capped by size")
+		{
+			auto importItemRequests = createImportItemRequests(10);
+			const auto itemSize = ImportHelper::getImportItemRequestSize(importItemRequests.front());
+
+			auto batches = ImportHelper::splitImportItemRequestsIntoBatches(importItemRequests, 100, itemSize * 3);
+
+			REQUIRE(batches.size() == 4);
+			REQUIRE(batches[0].size() == 3);
+			REQUIRE(batches[3].size() == 1);
+		}
+
+		SECTION("Items bigger than the budget get their own batch")
+		{
+			auto importItemRequests = createImportItemRequests(3);
+			importItemRequests[1].renderFileWavBase64Size = 4096;
+
+			auto batches = ImportHelper::splitImportItemRequestsIntoBatches(importItemRequests, 100, 1024);
+
+			REQUIRE(batches.size() == 3);
+			REQUIRE(batches[1].size() == 1);
+			REQUIRE(batches[1].front().renderFileWavBase64Size == 4096);
+		}
+	}
+
+	TEST_CASE("createImportSummary")
+	{
+		Import::Summary summary;
+		Import::Task::Options importTaskOptions;
+		importTaskOptions.importDestination = "\\Actor-Mixer Hierarchy\\Default Work Unit";
+
+		SECTION("A completed import does not mention cancellation")
+		{
+			auto report = ImportHelper::createImportSummary("ReaWwise", juce::Time(), summary, importTaskOptions);
+
+			REQUIRE_FALSE(report.contains("cancelled"));
+			REQUIRE_FALSE(report.contains("Audio Files Not Imported"));
+		}
+
+		SECTION("A cancelled import lists the files that were not imported")
+		{
+			summary.cancelled = true;
+			summary.notImportedFiles = {"/Renders/footstep-001.wav", "/Renders/footstep-002.wav"};
+
+			auto report = ImportHelper::createImportSummary("ReaWwise", juce::Time(), summary, importTaskOptions);
+
+			REQUIRE(report.contains("2 audio file(s)</a> were not imported"));
+			REQUIRE(report.contains("<td>/Renders/footstep-001.wav</td>"));
+			REQUIRE(report.contains("<td>/Renders/footstep-002.wav</td>"));
+		}
+	}
+
+	TEST_CASE("applyValueTreeDiff")
+	{
+		auto createNode = [](const juce::String& path, const juce::String& name)
+		{
+			Import::PreviewItemNode previewItem{name, Wwise::ObjectType::SoundVoice, Import::ObjectStatus::New, "", Import::WavStatus::Unknown, false};
+			return ImportHelper::previewItemNodeToValueTree(path, previewItem);
+		};
+
+		auto createSource = [&createNode](const std::vector<juce::String>& names)
+		{
+			juce::ValueTree source(IDs::previewItems);
+			auto parent = createNode("\\Actor-Mixer Hierarchy\\Parent", "Parent");
+
+			for(const auto& name : names)
+				parent.appendChild(createNode("\\Actor-Mixer Hierarchy\\Parent\\" + name, name), nullptr);
+
+			source.appendChild(parent, nullptr);
+			return source;
+		};
+
+		juce::ValueTree target(IDs::previewItems);
+		ImportHelper::applyValueTreeDiff(target, createSource({"A", "B", "C"}));
+
+		REQUIRE(target.isEquivalentTo(createSource({"A", "B", "C"})));
+
+		auto parent = target.getChild(0);
+		auto childA = parent.getChild(0);
+		auto childC = parent.getChild(2);
+
+		SECTION("Unchanged nodes keep their identity")
+		{
+			auto source = createSource({"A", "C", "D"});
+			source.getChild(0).getChild(1).setProperty(IDs::objectStatus, juce::VariantConverter<Import::ObjectStatus>::toVar(Import::ObjectStatus::NoChange), nullptr);
+
+			ImportHelper::applyValueTreeDiff(target, source);
+
+			REQUIRE(target.isEquivalentTo(source));
+			REQUIRE(target.getChild(0) == parent);
+			REQUIRE(parent.getNumChildren() == 3);
+			REQUIRE(parent.getChild(0) == childA);
+			REQUIRE(parent.getChild(1) == childC);
+		}
+
+		SECTION("Children are reordered to match the source")
+		{
+			auto source = createSource({"C", "B", "A"});
+
+			ImportHelper::applyValueTreeDiff(target, source);
+
+			REQUIRE(target.isEquivalentTo(source));
+			REQUIRE(parent.getChild(0) == childC);
+			REQUIRE(parent.getChild(2) == childA);
+		}
+
+		SECTION("Children sharing an object path are all kept")
+		{
+			auto source = createSource({"A", "B", "C"});
+			auto duplicateA = createNode("\\Actor-Mixer Hierarchy\\Parent\\A", "A");
+			duplicateA.setProperty(IDs::audioFilePath, "A-002.wav", nullptr);
+			source.getChild(0).appendChild(duplicateA, nullptr);
+
+			ImportHelper::applyValueTreeDiff(target, source);
+
+			REQUIRE(target.isEquivalentTo(source));
+			REQUIRE(parent.getNumChildren() == 4);
+			REQUIRE(parent.getChild(0) == childA);
+			REQUIRE(parent.getChild(3)[IDs::audioFilePath] == "A-002.wav");
+
+			source.getChild(0).removeChild(0, nullptr);
+
+			ImportHelper::applyValueTreeDiff(target, source);
+
+			REQUIRE(target.isEquivalentTo(source));
+			REQUIRE(parent.getNumChildren() == 3);
+			REQUIRE(parent.getChild(2)[IDs::audioFilePath] == "A-002.wav");
+		}
+
+		SECTION("Properties missing from the source are removed")
+		{
+			auto source = createSource({"A", "B", "C"});
+			source.getChild(0).getChild(0).removeProperty(IDs::audioFilePath, nullptr);
+
+			ImportHelper::applyValueTreeDiff(target, source);
+
+			REQUIRE(target.isEquivalentTo(source));
+			REQUIRE_FALSE(childA.hasProperty(IDs::audioFilePath));
+		}
 	}
 } // namespace AK::WwiseTransfer::Test
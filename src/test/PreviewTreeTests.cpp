@@ -0,0 +1,97 @@
+/*----------------------------------------------------------------------------------------
+
+Copyright (c) 2025 AUDIOKINETIC Inc.
+
+This file is licensed to use under the license available at:
+https://github.com/audiokinetic/ReaWwise/blob/main/License.txt (the "License").
+You may not use this file except in compliance with the License.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations under the License.
+
+----------------------------------------------------------------------------------------*/
+
+#include "Core/PreviewTree.h"
+#include "Model/IDs.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace AK::WwiseTransfer::Test
+{
+	TEST_CASE("PreviewTree")
+	{
+		PreviewTree previewTree;
+
+		auto actorMixerHierarchy = previewTree.getOrAddChild(PreviewTree::rootNode, "Actor-Mixer Hierarchy");
+		auto workUnit = previewTree.getOrAddChild(actorMixerHierarchy, "Default Work Unit");
+		auto soundA = previewTree.getOrAddChild(workUnit, "A");
+		auto soundB = previewTree.getOrAddChild(workUnit, "B");
+
+		SECTION("Existing children are reused")
+		{
+			REQUIRE(previewTree.getOrAddChild(PreviewTree::rootNode, "Actor-Mixer Hierarchy") == actorMixerHierarchy);
+			REQUIRE(previewTree.getOrAddChild(workUnit, "A") == soundA);
+			REQUIRE(previewTree.getNumNodes() == 5);
+		}
+
+		SECTION("Nodes are found by path")
+		{
+			REQUIRE(previewTree.findNode("\\Actor-Mixer Hierarchy\\Default Work Unit") == workUnit);
+			REQUIRE(previewTree.findNode("\\Actor-Mixer Hierarchy\\Default Work Unit\\B") == soundB);
+			REQUIRE(previewTree.findNode("\\Actor-Mixer Hierarchy\\Default Work Unit\\C") == PreviewTree::invalidNode);
+			REQUIRE(previewTree.findNode("\\Actor-Mixer Hierarchy\\A") == PreviewTree::invalidNode);
+			REQUIRE(previewTree.findNode("Actor-Mixer Hierarchy") == PreviewTree::invalidNode);
+
+			REQUIRE(previewTree.getPath(soundB) == "\\Actor-Mixer Hierarchy\\Default Work Unit\\B");
+			REQUIRE(previewTree.getParent(soundB) == workUnit);
+		}
+
+		SECTION("Children keep their insertion order")
+		{
+			REQUIRE(previewTree.getFirstChild(workUnit) == soundA);
+			REQUIRE(previewTree.getNextSibling(soundA) == soundB);
+			REQUIRE(previewTree.getNextSibling(soundB) == PreviewTree::invalidNode);
+		}
+
+		SECTION("Added children do not replace children with the same name")
+		{
+			auto duplicateA = previewTree.addChild(workUnit, "A");
+
+			REQUIRE(duplicateA != soundA);
+			REQUIRE(previewTree.getNumNodes() == 6);
+			REQUIRE(previewTree.getNextSibling(soundB) == duplicateA);
+
+			REQUIRE(previewTree.findNode("\\Actor-Mixer Hierarchy\\Default Work Unit\\A") == soundA);
+			REQUIRE(previewTree.getNextDuplicate(soundA) == duplicateA);
+			REQUIRE(previewTree.getNextDuplicate(duplicateA) == PreviewTree::invalidNode);
+			REQUIRE(previewTree.getOrAddChild(workUnit, "A") == soundA);
+
+			auto valueTree = previewTree.toValueTree(IDs::previewItems);
+			REQUIRE(valueTree.getChild(0).getChild(0).getNumChildren() == 3);
+		}
+
+		SECTION("Value tree uses the object path as a property")
+		{
+			Import::PreviewItemNode item{"B", Wwise::ObjectType::SoundVoice, Import::ObjectStatus::Replaced, "B.wav", Import::WavStatus::New, false};
+			previewTree.setItem(soundB, item);
+
+			auto valueTree = previewTree.toValueTree(IDs::previewItems);
+			auto soundBValueTree = valueTree.getChild(0).getChild(0).getChild(1);
+
+			REQUIRE(soundBValueTree.getType() == IDs::previewItem);
+			REQUIRE(soundBValueTree[IDs::objectPath] == "\\Actor-Mixer Hierarchy\\Default Work Unit\\B");
+			REQUIRE(soundBValueTree[IDs::objectName] == "B");
+			REQUIRE(soundBValueTree[IDs::audioFilePath] == "B.wav");
+		}
+
+		SECTION("Clear releases every node")
+		{
+			previewTree.clear();
+
+			REQUIRE(previewTree.getNumNodes() == 1);
+			REQUIRE(previewTree.findNode("\\Actor-Mixer Hierarchy") == PreviewTree::invalidNode);
+		}
+	}
+} // namespace AK::WwiseTransfer::Test
@@ -19,6 +19,7 @@ specific language governing permissions and limitations under the License.
 
 #include <catch2/catch_all.hpp>
 #include <catch2/trompeloeil.hpp>
+#include <reaper_plugin.h>
 
 namespace AK::ReaWwise::Test
 {
@@ -30,6 +31,9 @@ namespace AK::ReaWwise::Test
 	juce::File otherProjectDirectory = juce::File("/OtherProjectDirectory");
 #endif
 
+	// Resolved render patterns are cached, so the originals subfolder pattern must differ from the dummy pattern for both to be resolved
+	const juce::String testOriginalsSubfolder = "OriginalsSubfolder";
+
 	struct TestParams
 	{
 		TestParams(const juce::File& projectDirectory)
@@ -96,7 +100,7 @@ namespace AK::ReaWwise::Test
 
 	struct GetItemsForPreviewExpectations
 	{
-		GetItemsForPreviewExpectations(MockReaperPlugin& plugin, const TestParams& params)
+		GetItemsForPreviewExpectations(MockReaperPlugin& plugin, const TestParams& params, int projectStateCount = 0)
 			: plugin(plugin)
 			, reaproject(42)
 			, reaperProjectPath(params.projectDirectory.getChildFile("test.rpp").getFullPathName())
@@ -119,6 +123,12 @@ namespace AK::ReaWwise::Test
 			expectations[1] = NAMED_ALLOW_CALL(plugin, supportsReallocCommands())
 			                      .RETURN(false);
 
+			expectations[12] = NAMED_ALLOW_CALL(plugin, getProjectStateChangeCount(_))
+			                       .RETURN(projectStateCount);
+
+			expectations[13] = NAMED_ALLOW_CALL(plugin, getSetProjectInfo(_, _, 0, false))
+			                       .RETURN(0.0);
+
 			expectations[2] = NAMED_REQUIRE_CALL(plugin, getSetProjectInfo_String(_, _, _, false))
 			                      .TIMES(1)
 			                      .WITH(juce::String(_2) == renderTargetsEx)
@@ -204,7 +214,7 @@ namespace AK::ReaWwise::Test
 		juce::String renderPattern;
 		juce::String renderTargetsEx;
 
-		std::array<std::unique_ptr<trompeloeil::expectation>, 12> expectations;
+		std::array<std::unique_ptr<trompeloeil::expectation>, 14> expectations;
 	};
 
 	struct GetItemsForImportExpectations : private GetItemsForPreviewExpectations
@@ -233,7 +243,7 @@ namespace AK::ReaWwise::Test
 
 	std::vector<WwiseTransfer::Import::PreviewItem> getItemsForPreview(const TestParams& params)
 	{
-		WwiseTransfer::Import::Options importOptions{"", "", ""};
+		WwiseTransfer::Import::Options importOptions{"", testOriginalsSubfolder, ""};
 
 		MockReaperPlugin plugin;
 		ReaperContext reaperContext(plugin);
@@ -245,7 +255,7 @@ namespace AK::ReaWwise::Test
 
 	std::vector<WwiseTransfer::Import::Item> getItemsForImport(const TestParams& params)
 	{
-		WwiseTransfer::Import::Options importOptions{"", "", ""};
+		WwiseTransfer::Import::Options importOptions{"", testOriginalsSubfolder, ""};
 
 		MockReaperPlugin plugin;
 		ReaperContext reaperContext(plugin);
@@ -319,6 +329,48 @@ namespace AK::ReaWwise::Test
 				}
 			}
 
+			AND_WHEN("A render file path contains a semi-colon")
+			{
+				params.renderStats.clear();
+				params.renderStats << "FILE:" + projectDirectory.getChildFile("audio;file-001.wav").getFullPathName() + ";PEAK:-0000.000000;LRA:-0000.000000;LUFSMMAX:-0000.000000;LUFSSMAX:-0000.000000;LUFSI:-0000.000000;"
+								   << "FILE:" + projectDirectory.getChildFile("audio;File-002.wav").getFullPathName() + ";PEAK:-0000.000000;LRA:-0000.000000;LUFSMMAX:-0000.000000;LUFSSMAX:-0000.000000;LUFSI:-0000.000000";
+
+				auto importItems = getItemsForImport(params);
+
+				THEN("The semi-colon is kept in the render file path")
+				{
+					REQUIRE(importItems.size() == 2);
+					REQUIRE(importItems[0].renderFilePath == projectDirectory.getChildFile("audio;file-001.wav").getFullPathName());
+					REQUIRE(importItems[1].renderFilePath == projectDirectory.getChildFile("audio;File-002.wav").getFullPathName());
+				}
+			}
+
+			AND_WHEN("Render stats contains fewer files than render targets")
+			{
+				params.renderStats.clear();
+				params.renderStats << "FILE:" + projectDirectory.getChildFile("audio-file-001.wav").getFullPathName() + ";PEAK:-0000.000000;LRA:-0000.000000;LUFSMMAX:-0000.000000;LUFSSMAX:-0000.000000;LUFSI:-0000.000000;";
+
+				auto importItems = getItemsForImport(params);
+
+				THEN("Only the files in render stats are returned")
+				{
+					REQUIRE(importItems.size() == 1);
+					REQUIRE(importItems[0].renderFilePath == projectDirectory.getChildFile("audio-file-001.wav").getFullPathName());
+				}
+			}
+
+			AND_WHEN("Render stats contains more files than render targets")
+			{
+				params.renderStats << "FILE:" + projectDirectory.getChildFile("audio-file-003.wav").getFullPathName() + ";PEAK:-0000.000000;LRA:-0000.000000;LUFSMMAX:-0000.000000;LUFSSMAX:-0000.000000;LUFSI:-0000.000000;";
+
+				auto importItems = getItemsForImport(params);
+
+				THEN("No import items are returned")
+				{
+					REQUIRE(importItems.size() == 0);
+				}
+			}
+
 			AND_WHEN("Render stats is empty")
 			{
 				params.renderStats.clear();
@@ -467,4 +519,175 @@ namespace AK::ReaWwise::Test
 			}
 		}
 	}
+
+	struct CachedRenderPatternExpectations
+	{
+		CachedRenderPatternExpectations(MockReaperPlugin& plugin, const TestParams& params)
+			: reaproject(42)
+			, reaperProjectPath(params.projectDirectory.getChildFile("test.rpp").getFullPathName())
+			, resolvedOutputFilenameDblNullTerminated(WwiseTransfer::StringHelper::createDoubleNullTerminatedStringBuffer(params.renderTargets))
+			, renderPattern("RENDER_PATTERN")
+			, renderTargetsEx("RENDER_TARGETS_EX")
+		{
+			using trompeloeil::_; // wild card for matching any value
+
+			expectations[0] = NAMED_ALLOW_CALL(plugin, enumProjects(-1, _, _))
+			                      .SIDE_EFFECT(memcpy(_2, reaperProjectPath.toRawUTF8(), size_t(reaperProjectPath.getNumBytesAsUTF8()) + 1))
+			                      .RETURN((ReaProject*)&reaproject);
+
+			expectations[1] = NAMED_ALLOW_CALL(plugin, supportsReallocCommands())
+			                      .RETURN(false);
+
+			expectations[2] = NAMED_ALLOW_CALL(plugin, getProjectStateChangeCount(_))
+			                      .RETURN(1);
+
+			expectations[3] = NAMED_ALLOW_CALL(plugin, getSetProjectInfo(_, _, 0, false))
+			                      .RETURN(0.0);
+
+			expectations[4] = NAMED_ALLOW_CALL(plugin, getSetProjectInfo_String(_, _, _, false))
+			                      .WITH(juce::String(_2) == renderTargetsEx)
+			                      .SIDE_EFFECT(memcpy(_3, &resolvedOutputFilenameDblNullTerminated[0], size_t(resolvedOutputFilenameDblNullTerminated.size())))
+			                      .RETURN(true);
+
+			expectations[5] = NAMED_ALLOW_CALL(plugin, getSetProjectInfo_String(_, _, _, false))
+			                      .WITH(juce::String(_2) == renderPattern)
+			                      .SIDE_EFFECT(memcpy(_3, renderPattern.toRawUTF8(), size_t(renderPattern.getNumBytesAsUTF8()) + 1))
+			                      .RETURN(true);
+		}
+
+	private:
+		int reaproject;
+		juce::String reaperProjectPath;
+		std::vector<char> resolvedOutputFilenameDblNullTerminated;
+		juce::String renderPattern;
+		juce::String renderTargetsEx;
+
+		std::array<std::unique_ptr<trompeloeil::expectation>, 6> expectations;
+	};
+
+	SCENARIO("ReaperContext render pattern resolution")
+	{
+		TestParams params(projectDirectory);
+		WwiseTransfer::Import::Options importOptions{"", testOriginalsSubfolder, ""};
+
+		MockReaperPlugin plugin;
+		ReaperContext reaperContext(plugin);
+
+		GIVEN("Render patterns that were resolved once")
+		{
+			{
+				GetItemsForPreviewExpectations expectations(plugin, params, 1);
+				REQUIRE(reaperContext.getItemsForPreview(importOptions).size() == 2);
+			}
+
+			WHEN("The project did not change")
+			{
+				THEN("The render patterns are not resolved again")
+				{
+					CachedRenderPatternExpectations expectations(plugin, params);
+					auto previewItems = reaperContext.getItemsForPreview(importOptions);
+
+					REQUIRE(previewItems.size() == 2);
+					REQUIRE(previewItems[0].audioFilePath == params.renderTargets[0]);
+					REQUIRE(previewItems[1].audioFilePath == params.renderTargets[1]);
+				}
+			}
+
+			WHEN("The project state changed")
+			{
+				THEN("The render patterns are resolved again")
+				{
+					GetItemsForPreviewExpectations expectations(plugin, params, 2);
+					REQUIRE(reaperContext.getItemsForPreview(importOptions).size() == 2);
+				}
+			}
+		}
+	}
+
+	struct SessionChangedExpectations
+	{
+		SessionChangedExpectations(MockReaperPlugin& plugin, int projectStateCount)
+			: reaproject(42)
+			, reaperProjectPath(projectDirectory.getChildFile("test.rpp").getFullPathName())
+		{
+			using trompeloeil::_; // wild card for matching any value
+
+			expectations[0] = NAMED_ALLOW_CALL(plugin, enumProjects(-1, _, _))
+			                      .SIDE_EFFECT(memcpy(_2, reaperProjectPath.toRawUTF8(), size_t(reaperProjectPath.getNumBytesAsUTF8()) + 1))
+			                      .RETURN((ReaProject*)&reaproject);
+
+			expectations[1] = NAMED_ALLOW_CALL(plugin, supportsReallocCommands())
+			                      .RETURN(false);
+
+			expectations[2] = NAMED_ALLOW_CALL(plugin, getSetProjectInfo(_, _, 0, false))
+			                      .RETURN(0.0);
+
+			expectations[3] = NAMED_ALLOW_CALL(plugin, getSetProjectInfo_String(_, _, _, false))
+			                      .RETURN(false);
+
+			expectations[4] = NAMED_REQUIRE_CALL(plugin, getProjectStateChangeCount(_))
+			                      .TIMES(1)
+			                      .RETURN(projectStateCount);
+		}
+
+	private:
+		int reaproject;
+		juce::String reaperProjectPath;
+
+		std::array<std::unique_ptr<trompeloeil::expectation>, 5> expectations;
+	};
+
+	SCENARIO("ReaperContext sessionChanged")
+	{
+		using trompeloeil::_; // wild card for matching any value
+
+		MockReaperPlugin plugin;
+		auto reaperContext = std::make_unique<ReaperContext>(plugin);
+
+		void* changeNotifier = nullptr;
+
+		{
+			REQUIRE_CALL(plugin, registerFunction(_, _))
+				.WITH(juce::String(_1) == "csurf_inst")
+				.LR_SIDE_EFFECT(changeNotifier = _2)
+				.RETURN(1);
+
+			REQUIRE(reaperContext->registerChangeNotifications());
+		}
+
+		REQUIRE(changeNotifier != nullptr);
+
+		GIVEN("A session that was just checked")
+		{
+			{
+				SessionChangedExpectations expectations(plugin, 1);
+				REQUIRE(reaperContext->sessionChanged());
+			}
+
+			WHEN("Nothing was notified")
+			{
+				THEN("The session is not queried again before the poll interval elapses")
+				{
+					REQUIRE_FALSE(reaperContext->sessionChanged());
+				}
+			}
+
+			WHEN("REAPER notifies a change")
+			{
+				static_cast<IReaperControlSurface*>(changeNotifier)->SetTrackListChange();
+
+				THEN("The session is queried right away")
+				{
+					SessionChangedExpectations expectations(plugin, 2);
+					REQUIRE(reaperContext->sessionChanged());
+				}
+			}
+		}
+
+		REQUIRE_CALL(plugin, registerFunction(_, _))
+			.WITH(juce::String(_1) == "-csurf_inst" && _2 == changeNotifier)
+			.RETURN(1);
+
+		reaperContext.reset();
+	}
 } // namespace AK::ReaWwise::Test
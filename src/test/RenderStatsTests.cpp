@@ -0,0 +1,154 @@
+/*----------------------------------------------------------------------------------------
+
+Copyright (c) 2025 AUDIOKINETIC Inc.
+
+This file is licensed to use under the license available at:
+https://github.com/audiokinetic/ReaWwise/blob/main/License.txt (the "License").
+You may not use this file except in compliance with the License.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations under the License.
+
+----------------------------------------------------------------------------------------*/
+
+
+#include "RenderStats.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <juce_core/juce_core.h>
+#include <regex>
+
+namespace AK::ReaWwise::Test
+{
+	namespace
+	{
+		// Implementation getItemsForImport had before RenderStatsParser, kept as a baseline for the benchmark
+		std::vector<juce::String> legacyGetRenderFilePaths(juce::String renderStats)
+		{
+			std::vector<juce::String> renderFilePaths;
+
+			static juce::String fileToken("FILE:");
+			static juce::String delimiter(';' + fileToken);
+
+			if(renderStats.endsWithChar(';'))
+				renderStats << fileToken;
+			else
+				renderStats << delimiter;
+
+			int endPosition, startPosition = renderStats.indexOf(fileToken) + fileToken.length();
+
+			static std::regex regex("(.+?);[A-Z]+");
+
+			while((endPosition = renderStats.indexOf(startPosition, delimiter)) != -1)
+			{
+				auto finalRenderPath = renderStats.substring(startPosition, endPosition).toStdString();
+
+				std::smatch results;
+				if(std::regex_search(finalRenderPath, results, regex))
+					finalRenderPath = results[1];
+
+				renderFilePaths.emplace_back(finalRenderPath);
+
+				startPosition = endPosition + delimiter.length();
+			}
+
+			return renderFilePaths;
+		}
+
+		std::string createRenderStats(int fileCount)
+		{
+			std::string renderStats;
+
+			for(int i = 0; i < fileCount; ++i)
+				renderStats += "FILE:/Users/sound designer/Projects/My Game/Renders/Characters/Footsteps/footstep-" + std::to_string(i) + ".wav;PEAK:-3.012000;LRA:4.500000;LUFSMMAX:-12.250000;LUFSSMAX:-14.500000;LUFSI:-18.000000;";
+
+			return renderStats;
+		}
+	} // namespace
+
+	TEST_CASE("RenderStatsParser")
+	{
+		SECTION("Files and their fields are parsed")
+		{
+			const auto renderStats = RenderStatsParser::parse("FILE:/a.wav;PEAK:-1.5;LUFSI:-18.0;FILE:/b.wav;PEAK:-2.5;");
+
+			REQUIRE(renderStats.entries.size() == 2);
+			REQUIRE(renderStats.fields.size() == 3);
+
+			REQUIRE(renderStats.entries[0].filePath == "/a.wav");
+			REQUIRE(renderStats.entries[0].numFields == 2);
+			REQUIRE(renderStats.getField(renderStats.entries[0], "PEAK") == "-1.5");
+			REQUIRE(renderStats.getField(renderStats.entries[0], "LUFSI") == "-18.0");
+
+			REQUIRE(renderStats.entries[1].filePath == "/b.wav");
+			REQUIRE(renderStats.entries[1].numFields == 1);
+			REQUIRE(renderStats.getField(renderStats.entries[1], "PEAK") == "-2.5");
+			REQUIRE(renderStats.getField(renderStats.entries[1], "LUFSI").empty());
+		}
+
+		SECTION("A trailing semi-colon is optional")
+		{
+			const auto renderStats = RenderStatsParser::parse("FILE:/a.wav;PEAK:-1.5;FILE:/b.wav");
+
+			REQUIRE(renderStats.entries.size() == 2);
+			REQUIRE(renderStats.getField(renderStats.entries[0], "PEAK") == "-1.5");
+			REQUIRE(renderStats.entries[1].filePath == "/b.wav");
+			REQUIRE(renderStats.entries[1].numFields == 0);
+		}
+
+		SECTION("File paths may contain semi-colons and colons")
+		{
+			const auto renderStats = RenderStatsParser::parse("FILE:C:\\a;B.wav;PEAK:-1.5;FILE:/b;X:y;C:d.wav;LRA:2.0");
+
+			REQUIRE(renderStats.entries.size() == 2);
+			REQUIRE(renderStats.entries[0].filePath == "C:\\a;B.wav");
+			REQUIRE(renderStats.entries[1].filePath == "/b;X:y;C:d.wav");
+			REQUIRE(renderStats.getField(renderStats.entries[1], "LRA") == "2.0");
+		}
+
+		SECTION("Text before the first file is ignored")
+		{
+			const auto renderStats = RenderStatsParser::parse("Unex:pect;edTextFILE:/a.wav;PEAK:-1.5");
+
+			REQUIRE(renderStats.entries.size() == 1);
+			REQUIRE(renderStats.entries[0].filePath == "/a.wav");
+		}
+
+		SECTION("Nothing is parsed without a file")
+		{
+			REQUIRE(RenderStatsParser::parse("").entries.empty());
+			REQUIRE(RenderStatsParser::parse("/a.wav;PEAK:-1.5;").entries.empty());
+		}
+
+		SECTION("Results match the legacy parser")
+		{
+			const auto renderStats = createRenderStats(100);
+			const auto parsedRenderStats = RenderStatsParser::parse(renderStats);
+			const auto legacyRenderFilePaths = legacyGetRenderFilePaths(renderStats);
+
+			REQUIRE(parsedRenderStats.entries.size() == legacyRenderFilePaths.size());
+
+			for(std::size_t i = 0; i < legacyRenderFilePaths.size(); ++i)
+				REQUIRE(juce::String(std::string(parsedRenderStats.entries[i].filePath)) == legacyRenderFilePaths[i]);
+		}
+	}
+
+	TEST_CASE("RenderStatsParser benchmark", "[.benchmark]")
+	{
+		const auto renderStats = createRenderStats(10'000);
+		const juce::String renderStatsString(renderStats);
+
+		BENCHMARK("Legacy indexOf and std::regex parser, 10k files")
+		{
+			return legacyGetRenderFilePaths(renderStatsString).size();
+		};
+
+		BENCHMARK("RenderStatsParser, 10k files")
+		{
+			return RenderStatsParser::parse(renderStats).entries.size();
+		};
+	}
+} // namespace AK::ReaWwise::Test
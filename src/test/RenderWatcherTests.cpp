@@ -0,0 +1,118 @@
+/*----------------------------------------------------------------------------------------
+
+Copyright (c) 2025 AUDIOKINETIC Inc.
+
+This file is licensed to use under the license available at:
+https://github.com/audiokinetic/ReaWwise/blob/main/License.txt (the "License").
+You may not use this file except in compliance with the License.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations under the License.
+
+----------------------------------------------------------------------------------------*/
+
+
+#include "Core/RenderWatcher.h"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+
+namespace AK::WwiseTransfer::Test
+{
+	namespace
+	{
+		// Writes a RIFF/WAVE header followed by the given number of data bytes, with the RIFF size set to the size the file is expected to have
+		void writeWavFile(const juce::File& file, int dataSize, int expectedDataSize)
+		{
+			juce::MemoryOutputStream outputStream;
+			outputStream.write("RIFF", 4);
+			outputStream.writeInt(4 + expectedDataSize);
+			outputStream.write("WAVE", 4);
+			outputStream.writeRepeatedByte(0, static_cast<std::size_t>(dataSize));
+
+			file.replaceWithData(outputStream.getData(), outputStream.getDataSize());
+		}
+
+		std::vector<std::size_t> waitForAllRenderedTargets(RenderWatcher& renderWatcher)
+		{
+			std::vector<std::size_t> renderedTargets;
+
+			while(renderWatcher.waitForRenderedTargets(renderedTargets, 100))
+			{
+			}
+
+			std::sort(renderedTargets.begin(), renderedTargets.end());
+
+			return renderedTargets;
+		}
+	} // namespace
+
+	TEST_CASE("RenderWatcher")
+	{
+		auto tmpDir = juce::File::getSpecialLocation(juce::File::SpecialLocationType::tempDirectory)
+		                  .getChildFile("temp_" + juce::String::toHexString(juce::Random::getSystemRandom().nextInt()));
+
+		tmpDir.createDirectory();
+
+		SECTION("isWavFileComplete")
+		{
+			auto completeFile = tmpDir.getChildFile("Complete.wav");
+			writeWavFile(completeFile, 16, 16);
+
+			auto incompleteFile = tmpDir.getChildFile("Incomplete.wav");
+			writeWavFile(incompleteFile, 16, 32);
+
+			auto notWavFile = tmpDir.getChildFile("NotWav.wav");
+			notWavFile.replaceWithText("Not a wav file");
+
+			REQUIRE(RenderWatcher::isWavFileComplete(completeFile));
+			REQUIRE_FALSE(RenderWatcher::isWavFileComplete(incompleteFile));
+			REQUIRE_FALSE(RenderWatcher::isWavFileComplete(notWavFile));
+			REQUIRE_FALSE(RenderWatcher::isWavFileComplete(tmpDir.getChildFile("Missing.wav")));
+		}
+
+		SECTION("Rendered targets are reported while the render goes on")
+		{
+			auto staleFile = tmpDir.getChildFile("Stale.wav");
+			writeWavFile(staleFile, 16, 16);
+			staleFile.setLastModificationTime(juce::Time::getCurrentTime() - juce::RelativeTime::hours(1));
+
+			RenderWatcher renderWatcher({tmpDir.getChildFile("Complete.wav"), tmpDir.getChildFile("Incomplete.wav"), staleFile}, juce::Time::getCurrentTime());
+			renderWatcher.start();
+
+			writeWavFile(tmpDir.getChildFile("Complete.wav"), 16, 16);
+			writeWavFile(tmpDir.getChildFile("Incomplete.wav"), 16, 32);
+
+			std::vector<std::size_t> renderedTargets;
+
+			for(int attempt = 0; attempt < 50 && renderedTargets.empty(); ++attempt)
+				REQUIRE(renderWatcher.waitForRenderedTargets(renderedTargets, 100));
+
+			REQUIRE(renderedTargets == std::vector<std::size_t>{0});
+
+			SECTION("Once the render is over, incomplete wav files are taken as they are and files that were not written are reported as failed")
+			{
+				renderWatcher.renderFinished({});
+
+				REQUIRE(waitForAllRenderedTargets(renderWatcher) == std::vector<std::size_t>{1});
+				REQUIRE(renderWatcher.getFailedTargets() == std::vector<juce::File>{staleFile});
+			}
+
+			SECTION("Files renamed by the DAW are picked up once the render is over")
+			{
+				auto renamedFile = tmpDir.getChildFile("Stale-001.wav");
+				writeWavFile(renamedFile, 16, 16);
+
+				renderWatcher.renderFinished({tmpDir.getChildFile("Complete.wav").getFullPathName(), {}, renamedFile.getFullPathName()});
+
+				REQUIRE(waitForAllRenderedTargets(renderWatcher) == std::vector<std::size_t>{1, 2});
+				REQUIRE(renderWatcher.getRenderFile(2) == renamedFile);
+				REQUIRE(renderWatcher.getFailedTargets().empty());
+			}
+		}
+
+		tmpDir.deleteRecursively();
+	}
+} // namespace AK::WwiseTransfer::Test
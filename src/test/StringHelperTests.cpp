@@ -0,0 +1,59 @@
+/*----------------------------------------------------------------------------------------
+
+Copyright (c) 2025 AUDIOKINETIC Inc.
+
+This file is licensed to use under the license available at:
+https://github.com/audiokinetic/ReaWwise/blob/main/License.txt (the "License").
+You may not use this file except in compliance with the License.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations under the License.
+
+----------------------------------------------------------------------------------------*/
+
+
+#include "Helpers/StringHelper.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace AK::WwiseTransfer::Test
+{
+	TEST_CASE("splitDoubleNullTerminatedString")
+	{
+		SECTION("Round trip through createDoubleNullTerminatedStringBuffer")
+		{
+			const std::vector<juce::String> strings{"first", "second", "third"};
+
+			REQUIRE(StringHelper::splitDoubleNullTerminatedString(StringHelper::createDoubleNullTerminatedStringBuffer(strings)) == strings);
+		}
+
+		SECTION("Empty buffer")
+		{
+			REQUIRE(StringHelper::splitDoubleNullTerminatedString(StringHelper::createDoubleNullTerminatedStringBuffer({})).empty());
+			REQUIRE(StringHelper::splitDoubleNullTerminatedString(nullptr, 0).empty());
+		}
+
+		SECTION("Data after the double null terminator is ignored")
+		{
+			const char buffer[] = "first\0second\0\0third\0";
+
+			REQUIRE(StringHelper::splitDoubleNullTerminatedString(buffer, sizeof(buffer)) == std::vector<juce::String>{"first", "second"});
+		}
+
+		SECTION("A trailing string without terminator is ignored")
+		{
+			const std::vector<char> buffer{'a', '\0', 'b', 'c'};
+
+			REQUIRE(StringHelper::splitDoubleNullTerminatedString(buffer) == std::vector<juce::String>{"a"});
+		}
+
+		SECTION("UTF-8 strings")
+		{
+			const char buffer[] = "caf\xc3\xa9\0";
+
+			REQUIRE(StringHelper::splitDoubleNullTerminatedString(buffer, sizeof(buffer)) == std::vector<juce::String>{juce::CharPointer_UTF8("caf\xc3\xa9")});
+		}
+	}
+} // namespace AK::WwiseTransfer::Test
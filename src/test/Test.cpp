@@ -20,6 +20,8 @@ specific language governing permissions and limitations under the License.
 #include <catch2/catch_test_macros.hpp>
 #include <juce_core/juce_core.h>
 #include <memory>
+#include <string>
+#include <string_view>
 
 namespace AK::WwiseTransfer
 {
@@ -79,6 +81,255 @@ namespace AK::WwiseTransfer
 
 		REQUIRE(counter == 2);
 	}
+
+	TEST_CASE_METHOD(WaapiHelperTests, "WaapiHelper::executeWithRetry: does not retry permanent failures")
+	{
+		int counter = 0;
+		auto failsPermanently = [&counter]
+		{
+			counter++;
+			return WaapiHelper::AttemptStatus::PermanentFailure;
+		};
+
+		auto neverStop = []
+		{
+			return false;
+		};
+
+		REQUIRE_FALSE(WaapiHelper::executeWithRetry(failsPermanently, WaapiHelper::RetryPolicy{}, neverStop));
+		REQUIRE(counter == 1);
+	}
+
+	TEST_CASE_METHOD(WaapiHelperTests, "WaapiHelper::executeWithRetry: retries transient failures until success")
+	{
+		int counter = 0;
+		auto succeedsOnThirdTry = [&counter]
+		{
+			counter++;
+			return counter == 3 ? WaapiHelper::AttemptStatus::Succeeded : WaapiHelper::AttemptStatus::TransientFailure;
+		};
+
+		auto neverStop = []
+		{
+			return false;
+		};
+
+		WaapiHelper::RetryPolicy retryPolicy;
+		retryPolicy.initialDelayMs = 1;
+
+		REQUIRE(WaapiHelper::executeWithRetry(succeedsOnThirdTry, retryPolicy, neverStop));
+		REQUIRE(counter == 3);
+	}
+
+	TEST_CASE_METHOD(WaapiHelperTests, "WaapiHelper::executeWithRetry: gives up once the deadline is reached")
+	{
+		int counter = 0;
+		auto alwaysFails = [&counter]
+		{
+			counter++;
+			return WaapiHelper::AttemptStatus::TransientFailure;
+		};
+
+		auto neverStop = []
+		{
+			return false;
+		};
+
+		WaapiHelper::RetryPolicy retryPolicy;
+		retryPolicy.initialDelayMs = 50;
+		retryPolicy.maxDelayMs = 50;
+		retryPolicy.jitter = 0;
+		retryPolicy.deadlineMs = 120;
+
+		const auto startMs = juce::Time::getMillisecondCounter();
+
+		REQUIRE_FALSE(WaapiHelper::executeWithRetry(alwaysFails, retryPolicy, neverStop));
+		REQUIRE(juce::Time::getMillisecondCounter() - startMs < 500);
+		REQUIRE(counter >= 2);
+		REQUIRE(counter <= 3);
+	}
+
+	TEST_CASE_METHOD(WaapiHelperTests, "WaapiHelper::executeWithRetry: the deadline is chosen per call")
+	{
+		int callTimeoutMs = 0;
+		auto recordsCallTimeout = [&callTimeoutMs]
+		{
+			callTimeoutMs = WaapiHelper::getCallTimeoutMs(-1);
+			return WaapiHelper::AttemptStatus::Succeeded;
+		};
+
+		auto neverStop = []
+		{
+			return false;
+		};
+
+		SECTION("Heavy calls are bounded by a budget that grows with the number of objects")
+		{
+			using namespace WaapiHelper::WaapiHelperConstants;
+
+			REQUIRE(WaapiHelper::getHeavyCallDeadlineMs(0) == heavyCallBaseDeadlineMs);
+			REQUIRE(WaapiHelper::getHeavyCallDeadlineMs(1000) == heavyCallBaseDeadlineMs + 1000 * heavyCallDeadlineMsPerObject);
+			REQUIRE(WaapiHelper::getHeavyCallDeadlineMs(std::numeric_limits<std::size_t>::max()) == maxHeavyCallDeadlineMs);
+
+			const auto retryPolicy = WaapiHelper::createRetryPolicy(WaapiHelper::getHeavyCallDeadlineMs(1000));
+
+			REQUIRE(WaapiHelper::executeWithRetry(recordsCallTimeout, retryPolicy, neverStop));
+			REQUIRE(callTimeoutMs > lightCallDeadlineMs);
+			REQUIRE(callTimeoutMs <= retryPolicy.deadlineMs);
+		}
+
+		SECTION("Calls made with the default policy are bounded")
+		{
+			REQUIRE(WaapiHelper::executeWithRetry(recordsCallTimeout, WaapiHelper::RetryPolicy{}, neverStop));
+			REQUIRE(callTimeoutMs > 0);
+			REQUIRE(callTimeoutMs <= WaapiHelper::WaapiHelperConstants::heavyCallBaseDeadlineMs);
+		}
+
+		SECTION("Calls made with a deadline are bounded by it")
+		{
+			const auto retryPolicy = WaapiHelper::createRetryPolicy(WaapiHelper::WaapiHelperConstants::lightCallDeadlineMs);
+
+			REQUIRE(WaapiHelper::executeWithRetry(recordsCallTimeout, retryPolicy, neverStop));
+			REQUIRE(callTimeoutMs > 0);
+			REQUIRE(callTimeoutMs <= WaapiHelper::WaapiHelperConstants::lightCallDeadlineMs);
+		}
+
+		SECTION("Without a deadline, retries are only limited by the number of attempts")
+		{
+			int counter = 0;
+			auto alwaysFails = [&counter]
+			{
+				counter++;
+				return WaapiHelper::AttemptStatus::TransientFailure;
+			};
+
+			auto retryPolicy = WaapiHelper::createRetryPolicy(WaapiHelper::WaapiHelperConstants::noDeadline);
+			retryPolicy.initialDelayMs = 1;
+			retryPolicy.maxDelayMs = 1;
+			retryPolicy.maxAttempts = 4;
+
+			REQUIRE_FALSE(WaapiHelper::executeWithRetry(alwaysFails, retryPolicy, neverStop));
+			REQUIRE(counter == 4);
+		}
+
+		REQUIRE(WaapiHelper::callDeadlineMs == 0);
+	}
+
+	TEST_CASE_METHOD(WaapiHelperTests, "WaapiHelper::executeWithRetry: stops waiting as soon as it is cancelled")
+	{
+		WaapiHelper::CancellationToken cancellationToken;
+
+		int counter = 0;
+		auto failsThenCancels = [&counter, &cancellationToken]
+		{
+			counter++;
+
+			juce::Thread::launch([&cancellationToken]
+				{
+					juce::Thread::sleep(20);
+					cancellationToken.cancel();
+				});
+
+			return WaapiHelper::AttemptStatus::TransientFailure;
+		};
+
+		auto isCancelled = [&cancellationToken]
+		{
+			return cancellationToken.isCancelled();
+		};
+
+		WaapiHelper::RetryPolicy retryPolicy;
+		retryPolicy.initialDelayMs = 5'000;
+		retryPolicy.jitter = 0;
+
+		const auto startMs = juce::Time::getMillisecondCounter();
+
+		REQUIRE_FALSE(WaapiHelper::executeWithRetry(failsThenCancels, retryPolicy, isCancelled));
+		REQUIRE(juce::Time::getMillisecondCounter() - startMs < 1'000);
+		REQUIRE(counter == 1);
+	}
+
+	TEST_CASE_METHOD(WaapiHelperTests, "WaapiHelper::getRetryDelayMs: grows exponentially up to the maximum delay")
+	{
+		WaapiHelper::RetryPolicy retryPolicy;
+		retryPolicy.initialDelayMs = 100;
+		retryPolicy.maxDelayMs = 1'000;
+		retryPolicy.backoffMultiplier = 2.0;
+
+		REQUIRE(WaapiHelper::getRetryDelayMs(retryPolicy, 1) == 100);
+		REQUIRE(WaapiHelper::getRetryDelayMs(retryPolicy, 2) == 200);
+		REQUIRE(WaapiHelper::getRetryDelayMs(retryPolicy, 4) == 800);
+		REQUIRE(WaapiHelper::getRetryDelayMs(retryPolicy, 5) == 1'000);
+	}
+
+	TEST_CASE_METHOD(WaapiHelperTests, "WaapiHelper::isTransientError")
+	{
+		Waapi::Error connectionError;
+		REQUIRE(WaapiHelper::isTransientError(connectionError));
+
+		Waapi::Error lockedError;
+		lockedError.uri = "ak.wwise.locked";
+		REQUIRE(WaapiHelper::isTransientError(lockedError));
+
+		Waapi::Error unknownObjectError;
+		unknownObjectError.uri = "ak.wwise.query.unknown_object";
+		REQUIRE_FALSE(WaapiHelper::isTransientError(unknownObjectError));
+	}
+	TEST_CASE_METHOD(WaapiHelperTests, "WaapiHelper::toLogString")
+	{
+		using namespace WwiseAuthoringAPI;
+
+		SECTION("Small payloads are logged in full")
+		{
+			const AkJson json(AkJson::Map{
+				{"objects", AkJson::Array{AkVariant{"first"}, AkVariant{"second"}}},
+			});
+
+			REQUIRE(WaapiHelper::toLogString(json) == "{\"objects\":[\"first\",\"second\"]}");
+		}
+
+		SECTION("Large payloads are truncated and summarized")
+		{
+			const std::string payload(1'000'000, 'A');
+
+			const AkJson json(AkJson::Map{
+				{"imports", AkJson::Array{AkVariant{payload}, AkVariant{payload}}},
+			});
+
+			const auto logString = WaapiHelper::toLogString(json, 100);
+
+			REQUIRE(logString.startsWith("{\"imports\":[\"AAAA"));
+			REQUIRE(logString.contains("truncated, 2 items"));
+			REQUIRE(logString.length() < 200);
+		}
+
+		SECTION("Large strings are truncated and summarized")
+		{
+			const std::string payload(1'000'000, 'A');
+
+			const auto logString = WaapiHelper::toLogString(std::string_view(payload), 100);
+
+			REQUIRE(logString.startsWith("AAAA"));
+			REQUIRE(logString.contains("truncated"));
+			REQUIRE(logString.length() < 200);
+		}
+	}
+
+	TEST_CASE_METHOD(WaapiHelperTests, "WaapiHelper::estimateJsonSize")
+	{
+		using namespace WwiseAuthoringAPI;
+
+		const std::string payload(1'000, 'A');
+
+		const AkJson json(AkJson::Map{
+			{"imports", AkJson::Array{AkVariant{payload}, AkVariant{payload}, AkVariant{payload}}},
+		});
+
+		const auto size = WaapiHelper::estimateJsonSize(json);
+
+		REQUIRE(size.items == 3);
+		REQUIRE(size.bytes >= 3'000);
+	}
 #pragma endregion WaapiHelperTests
 
 #pragma region WwiseModelTests
@@ -0,0 +1,97 @@
+/*----------------------------------------------------------------------------------------
+
+Copyright (c) 2025 AUDIOKINETIC Inc.
+
+This file is licensed to use under the license available at:
+https://github.com/audiokinetic/ReaWwise/blob/main/License.txt (the "License").
+You may not use this file except in compliance with the License.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations under the License.
+
+----------------------------------------------------------------------------------------*/
+
+#include "Core/WaapiMetrics.h"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+
+namespace AK::WwiseTransfer::Test
+{
+	namespace
+	{
+		WaapiMetrics::ProcedureSnapshot getProcedure(const juce::String& uri)
+		{
+			const auto snapshot = WaapiMetrics::getInstance().getSnapshot();
+
+			auto it = std::find_if(snapshot.begin(), snapshot.end(), [&uri](const WaapiMetrics::ProcedureSnapshot& procedure)
+				{
+					return procedure.uri == uri;
+				});
+
+			return it != snapshot.end() ? *it : WaapiMetrics::ProcedureSnapshot{};
+		}
+	} // namespace
+
+	TEST_CASE("WaapiMetrics")
+	{
+		auto& metrics = WaapiMetrics::getInstance();
+		metrics.reset();
+
+		SECTION("Calls are recorded per procedure")
+		{
+			metrics.recordCall("test.metrics.first", true, 1.0, 100, 1000);
+			metrics.recordCall("test.metrics.first", false, 1.0, 100, 1000);
+			metrics.recordCall("test.metrics.second", true, 1.0, 10, 10);
+
+			const auto first = getProcedure("test.metrics.first");
+
+			REQUIRE(first.calls == 2);
+			REQUIRE(first.failures == 1);
+			REQUIRE(first.requestBytes == 200);
+			REQUIRE(first.responseBytes == 2000);
+			REQUIRE(getProcedure("test.metrics.second").calls == 1);
+		}
+
+		SECTION("Calls made during a retry are counted as retries")
+		{
+			metrics.recordCall("test.metrics.retry", true, 1.0, 0, 0);
+
+			{
+				const WaapiMetrics::ScopedRetry scopedRetry(true);
+				metrics.recordCall("test.metrics.retry", true, 1.0, 0, 0);
+			}
+
+			metrics.recordCall("test.metrics.retry", true, 1.0, 0, 0);
+
+			REQUIRE(getProcedure("test.metrics.retry").retries == 1);
+		}
+
+		SECTION("Latency percentiles come from the histogram")
+		{
+			for(int i = 0; i < 98; ++i)
+				metrics.recordCall("test.metrics.latency", true, 1.0, 0, 0);
+
+			metrics.recordCall("test.metrics.latency", true, 1000.0, 0, 0);
+			metrics.recordCall("test.metrics.latency", true, 1000.0, 0, 0);
+
+			const auto procedure = getProcedure("test.metrics.latency");
+
+			REQUIRE(procedure.p50LatencyMs >= 1.0);
+			REQUIRE(procedure.p50LatencyMs < 1.5);
+			REQUIRE(procedure.p95LatencyMs < 1.5);
+			REQUIRE(procedure.p99LatencyMs >= 1000.0);
+			REQUIRE(procedure.p99LatencyMs < 1500.0);
+		}
+
+		SECTION("Reset clears the statistics")
+		{
+			metrics.recordCall("test.metrics.reset", true, 1.0, 0, 0);
+			metrics.reset();
+
+			REQUIRE(getProcedure("test.metrics.reset").calls == 0);
+		}
+	}
+} // namespace AK::WwiseTransfer::Test
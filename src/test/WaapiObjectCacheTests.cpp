@@ -0,0 +1,192 @@
+/*----------------------------------------------------------------------------------------
+
+Copyright (c) 2025 AUDIOKINETIC Inc.
+
+This file is licensed to use under the license available at:
+https://github.com/audiokinetic/ReaWwise/blob/main/License.txt (the "License").
+You may not use this file except in compliance with the License.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations under the License.
+
+----------------------------------------------------------------------------------------*/
+
+#include "Core/WaapiObjectCache.h"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <set>
+
+namespace AK::WwiseTransfer::Test
+{
+	namespace
+	{
+		Waapi::ObjectResponse createObject(const juce::String& id, const juce::String& path)
+		{
+			Waapi::ObjectResponse object;
+			object.id = id;
+			object.path = path;
+			object.name = path.fromLastOccurrenceOf("\\", false, false);
+
+			return object;
+		}
+
+		bool containsPath(const Waapi::ObjectResponseSet& objects, const juce::String& path)
+		{
+			return std::any_of(objects.begin(), objects.end(), [&path](const Waapi::ObjectResponse& object)
+				{
+					return object.path == path;
+				});
+		}
+
+		const juce::String root = "\\Containers";
+		const juce::String workUnit = "\\Containers\\Default Work Unit";
+		const juce::String folder = "\\Containers\\Default Work Unit\\Folder";
+		const juce::String sound = "\\Containers\\Default Work Unit\\Folder\\Sound";
+		const juce::String sibling = "\\Containers\\Default Work Unit\\Folder Sibling";
+
+		void fillCache(WaapiObjectCache& objectCache)
+		{
+			objectCache.addObjectAncestorsAndDescendants(workUnit,
+				{createObject("root", root), createObject("workUnit", workUnit), createObject("folder", folder), createObject("sound", sound), createObject("sibling", sibling)},
+				objectCache.getRevision());
+		}
+	} // namespace
+
+	TEST_CASE("WaapiObjectCache")
+	{
+		WaapiObjectCache objectCache;
+
+		SECTION("Unknown paths are not answered")
+		{
+			REQUIRE_FALSE(objectCache.getObjectAncestorsAndDescendants(workUnit).has_value());
+			REQUIRE_FALSE(objectCache.getObject(workUnit).has_value());
+		}
+
+		SECTION("Mirrored subtrees are answered from memory")
+		{
+			fillCache(objectCache);
+
+			auto objects = objectCache.getObjectAncestorsAndDescendants(folder);
+
+			REQUIRE(objects.has_value());
+			REQUIRE(objects->size() == 4);
+			REQUIRE(containsPath(*objects, root));
+			REQUIRE(containsPath(*objects, sound));
+			REQUIRE_FALSE(containsPath(*objects, sibling));
+
+			REQUIRE(objectCache.getObject(sound)->id == "sound");
+
+			// Paths that do not exist in a mirrored subtree are known to be missing
+			REQUIRE(objectCache.getObject(folder + "\\Missing")->id.isEmpty());
+			REQUIRE_FALSE(objectCache.getObject("\\Events\\Default Work Unit").has_value());
+		}
+
+		SECTION("Results of queries started before an event are discarded")
+		{
+			const auto revision = objectCache.getRevision();
+
+			objectCache.onObjectCreated(createObject("other", "\\Events\\Other"), {});
+			objectCache.addObjectAncestorsAndDescendants(workUnit, {createObject("root", root), createObject("workUnit", workUnit)}, revision);
+
+			REQUIRE_FALSE(objectCache.getObjectAncestorsAndDescendants(workUnit).has_value());
+		}
+
+		SECTION("Created objects are added to mirrored subtrees")
+		{
+			fillCache(objectCache);
+
+			objectCache.onObjectCreated(createObject("new", folder + "\\New"), "folder");
+
+			REQUIRE(containsPath(*objectCache.getObjectAncestorsAndDescendants(workUnit), folder + "\\New"));
+		}
+
+		SECTION("Missing paths are answered with their existing ancestors until they are created")
+		{
+			const auto missing = workUnit + "\\Missing";
+
+			objectCache.addObjectAncestorsAndDescendants(missing, {createObject("root", root), createObject("workUnit", workUnit)}, objectCache.getRevision());
+
+			REQUIRE(objectCache.getObjectAncestorsAndDescendants(missing)->size() == 2);
+
+			objectCache.onObjectCreated(createObject("missing", missing), "workUnit");
+
+			auto objects = objectCache.getObjectAncestorsAndDescendants(missing);
+
+			REQUIRE(objects->size() == 3);
+			REQUIRE(containsPath(*objects, missing));
+		}
+
+		SECTION("Objects queried by path are answered until an unknown path is asked")
+		{
+			const auto missing = folder + "\\Missing";
+			const std::set<juce::String> objectPaths{root, workUnit, folder, missing};
+
+			objectCache.addObjects(objectPaths, {createObject("root", root), createObject("workUnit", workUnit), createObject("folder", folder)}, objectCache.getRevision());
+
+			auto objects = objectCache.getObjects(objectPaths);
+
+			REQUIRE(objects.has_value());
+			REQUIRE(objects->size() == 3);
+			REQUIRE_FALSE(containsPath(*objects, missing));
+			REQUIRE_FALSE(objectCache.getObjects({root, sound}).has_value());
+
+			objectCache.onObjectCreated(createObject("missing", missing), "folder");
+
+			REQUIRE(containsPath(*objectCache.getObjects(objectPaths), missing));
+		}
+
+		SECTION("Deleted objects are removed with their descendants")
+		{
+			fillCache(objectCache);
+
+			objectCache.onObjectDeleted(createObject("folder", {}));
+
+			auto objects = objectCache.getObjectAncestorsAndDescendants(workUnit);
+
+			REQUIRE_FALSE(containsPath(*objects, folder));
+			REQUIRE_FALSE(containsPath(*objects, sound));
+			REQUIRE(containsPath(*objects, sibling));
+		}
+
+		SECTION("Renamed objects move their descendants")
+		{
+			fillCache(objectCache);
+
+			const juce::String renamedFolder = workUnit + "\\Renamed";
+
+			objectCache.onObjectRenamed(createObject("folder", renamedFolder), "Folder");
+
+			auto objects = objectCache.getObjectAncestorsAndDescendants(workUnit);
+
+			REQUIRE(containsPath(*objects, renamedFolder));
+			REQUIRE(containsPath(*objects, renamedFolder + "\\Sound"));
+			REQUIRE(containsPath(*objects, sibling));
+			REQUIRE_FALSE(containsPath(*objects, folder));
+			REQUIRE(objectCache.getObject(renamedFolder)->name == "Renamed");
+		}
+
+		SECTION("Objects moved into a mirrored subtree invalidate the cache")
+		{
+			fillCache(objectCache);
+
+			objectCache.onChildAdded(createObject("moved", folder + "\\Moved"));
+
+			REQUIRE_FALSE(objectCache.getObjectAncestorsAndDescendants(workUnit).has_value());
+		}
+
+		SECTION("Imported objects are queried again")
+		{
+			fillCache(objectCache);
+
+			objectCache.onObjectsImported({createObject("sound", sound)});
+
+			REQUIRE_FALSE(objectCache.getObject(sound).has_value());
+			REQUIRE_FALSE(objectCache.getObjectAncestorsAndDescendants(workUnit).has_value());
+			REQUIRE_FALSE(objectCache.getObjectAncestorsAndDescendants(folder).has_value());
+			REQUIRE(objectCache.getObject(sibling)->id == "sibling");
+		}
+	}
+} // namespace AK::WwiseTransfer::Test
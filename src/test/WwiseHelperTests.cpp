@@ -72,6 +72,12 @@ namespace AK::WwiseTransfer::Test
 		}
 	}
 
+	TEST_CASE("getPathDepth")
+	{
+		for(auto testPath : {"", "\\", "\\test", "\\test\\path\\directory\\multiple", "\\<testObject>testName\\path", "\\test\\\\path", "\\test\\"})
+			REQUIRE(static_cast<std::size_t>(WwiseHelper::getPathDepth(testPath)) == WwiseHelper::pathToPathParts(testPath).size());
+	}
+
 	TEST_CASE("pathToAncestorPaths")
 	{
 		SECTION("Wwise Object Directory")
@@ -0,0 +1,201 @@
+/*----------------------------------------------------------------------------------------
+
+Copyright (c) 2025 AUDIOKINETIC Inc.
+
+This file is licensed to use under the license available at:
+https://github.com/audiokinetic/ReaWwise/blob/main/License.txt (the "License").
+You may not use this file except in compliance with the License.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations under the License.
+
+----------------------------------------------------------------------------------------*/
+
+#include "Helpers/WwiseHelper.h"
+#include "Helpers/WwisePath.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <regex>
+
+namespace AK::WwiseTransfer::Test
+{
+	namespace
+	{
+		std::vector<std::string_view> getParts(std::string_view path)
+		{
+			std::vector<std::string_view> parts;
+			WwisePath::Tokenizer tokenizer(path);
+
+			for(std::string_view part; tokenizer.next(part);)
+				parts.push_back(part);
+
+			return parts;
+		}
+
+		// Implementations the path helpers had before they were built on WwisePath, kept as a baseline for the benchmark
+		juce::String legacyPathToPathWithoutObjectTypes(const juce::String& objectPath)
+		{
+			static std::regex pattern("<.+?>");
+			auto result = std::regex_replace(objectPath.toStdString(), pattern, "");
+			return juce::String(result);
+		}
+
+		std::vector<juce::String> legacyPathToPathParts(const juce::String& objectPath)
+		{
+			juce::StringArray parts;
+			parts.addTokens(objectPath.trimCharactersAtStart("\\"), "\\", "");
+
+			std::vector<juce::String> objectPathParts;
+			for(auto& part : parts)
+				objectPathParts.emplace_back(part);
+
+			return objectPathParts;
+		}
+
+		std::vector<juce::String> legacyPathToAncestorPaths(const juce::String& objectPath)
+		{
+			std::vector<juce::String> ancestors;
+
+			auto parts = legacyPathToPathParts(objectPath);
+
+			juce::String current;
+			for(std::size_t i = 0; i + 1 < parts.size(); ++i)
+			{
+				current << "\\" << parts[i];
+				ancestors.emplace_back(current);
+			}
+
+			return ancestors;
+		}
+	} // namespace
+
+	TEST_CASE("WwisePath")
+	{
+		SECTION("Tokenizer")
+		{
+			REQUIRE(getParts("") == std::vector<std::string_view>{});
+			REQUIRE(getParts("\\") == std::vector<std::string_view>{});
+			REQUIRE(getParts("\\A\\<Sound SFX>B") == std::vector<std::string_view>{"A", "<Sound SFX>B"});
+			REQUIRE(getParts("\\\\A\\\\B\\") == std::vector<std::string_view>{"A", "", "B", ""});
+			REQUIRE(WwisePath::countParts("\\\\A\\\\B\\") == 4);
+		}
+
+		SECTION("Ancestors are views of the path")
+		{
+			const std::string_view path = "\\A\\<Work Unit>B\\C";
+			std::vector<std::string_view> ancestors;
+
+			WwisePath::forEachAncestor(path, [&ancestors](std::string_view ancestor)
+				{
+					ancestors.push_back(ancestor);
+				});
+
+			REQUIRE(ancestors == std::vector<std::string_view>{"\\A", "\\A\\<Work Unit>B"});
+			REQUIRE(ancestors.front().data() == path.data());
+		}
+
+		SECTION("Object name and type")
+		{
+			REQUIRE(WwisePath::getObjectName("\\A\\<Sound SFX>B") == "B");
+			REQUIRE(WwisePath::getObjectName("\\A\\B") == "B");
+			REQUIRE(WwisePath::getObjectTypeName("\\A\\<Sound SFX>B") == "Sound SFX");
+			REQUIRE(WwisePath::getObjectType("\\A\\<Random Container>B") == Wwise::ObjectType::RandomContainer);
+			REQUIRE(WwisePath::getObjectType("\\Actor-Mixer Hierarchy") == Wwise::ObjectType::ActorMixer);
+			REQUIRE(WwisePath::getObjectType("\\A\\B") == Wwise::ObjectType::Unknown);
+		}
+
+		SECTION("Parsed path")
+		{
+			const WwisePath::ParsedPath parsedPath("\\Actor-Mixer Hierarchy\\<Work Unit>Default Work Unit\\<Sound SFX>Footstep");
+
+			REQUIRE(parsedPath.size() == 3);
+			REQUIRE(parsedPath.getPart(1) == "<Work Unit>Default Work Unit");
+			REQUIRE(parsedPath.getName(1) == "Default Work Unit");
+			REQUIRE(parsedPath.getTypeName(1) == "Work Unit");
+			REQUIRE(parsedPath.getName(0) == "Actor-Mixer Hierarchy");
+			REQUIRE(parsedPath.getTypeName(0).empty());
+			REQUIRE(parsedPath.getAncestorOrSelf(0) == "\\Actor-Mixer Hierarchy");
+			REQUIRE(parsedPath.getAncestorOrSelf(2) == parsedPath.getPath());
+		}
+
+		SECTION("Rooted paths")
+		{
+			REQUIRE(WwisePath::toRootedString("\\A\\B") == "\\A\\B");
+			REQUIRE(WwisePath::toRootedString("A\\B") == "\\A\\B");
+			REQUIRE(WwisePath::toRootedString(WwisePath::ParsedPath("A\\<Folder>B").getAncestorOrSelf(0)) == "\\A");
+		}
+
+		SECTION("Deep parsed path")
+		{
+			juce::String path;
+
+			for(int i = 0; i < 40; ++i)
+				path << "\\<Virtual Folder>" << i;
+
+			const WwisePath::ParsedPath parsedPath(WwisePath::toStringView(path));
+
+			REQUIRE(parsedPath.size() == 40);
+			REQUIRE(parsedPath.getName(39) == "39");
+			REQUIRE(parsedPath.getTypeName(35) == "Virtual Folder");
+		}
+
+		SECTION("Helpers match their previous implementation")
+		{
+			for(juce::String path : {"", "\\", "\\A", "\\A\\<Sound SFX>B", "\\<Work Unit>A\\<>B>C\\<D", "\\A\\\\B\\", "A\\<Folder>B", "\\\\A\\B"})
+			{
+				REQUIRE(WwiseHelper::pathToPathWithoutObjectTypes(path) == legacyPathToPathWithoutObjectTypes(path));
+				REQUIRE(WwiseHelper::pathToPathParts(path) == legacyPathToPathParts(path));
+
+				if(path.isNotEmpty())
+					REQUIRE(WwiseHelper::pathToAncestorPaths(path) == legacyPathToAncestorPaths(path));
+			}
+		}
+	}
+
+	TEST_CASE("WwisePath benchmark", "[.benchmark]")
+	{
+		std::vector<juce::String> paths;
+		paths.reserve(100'000);
+
+		for(int i = 0; i < 100'000; ++i)
+			paths.emplace_back("\\Actor-Mixer Hierarchy\\<Work Unit>Default Work Unit\\<Actor-Mixer>Characters\\<Random Container>Footsteps " + juce::String(i / 100) + "\\<Sound SFX>Footstep " + juce::String(i));
+
+		BENCHMARK("Legacy pathToPathWithoutObjectTypes and pathToAncestorPaths, 100k paths")
+		{
+			std::size_t count = 0;
+
+			for(const auto& path : paths)
+				count += legacyPathToPathWithoutObjectTypes(path).length() + legacyPathToAncestorPaths(path).size();
+
+			return count;
+		};
+
+		BENCHMARK("WwiseHelper pathToPathWithoutObjectTypes and pathToAncestorPaths, 100k paths")
+		{
+			std::size_t count = 0;
+
+			for(const auto& path : paths)
+				count += WwiseHelper::pathToPathWithoutObjectTypes(path).length() + WwiseHelper::pathToAncestorPaths(path).size();
+
+			return count;
+		};
+
+		BENCHMARK("WwisePath parse and ancestors, 100k paths")
+		{
+			std::size_t count = 0;
+
+			for(const auto& path : paths)
+			{
+				const WwisePath::ParsedPath parsedPath(WwisePath::toStringView(path));
+
+				for(std::size_t i = 0; i < parsedPath.size(); ++i)
+					count += parsedPath.getName(i).size() + parsedPath.getAncestorOrSelf(i).size();
+			}
+
+			return count;
+		};
+	}
+} // namespace AK::WwiseTransfer::Test